@@ -3,16 +3,45 @@
 #ifndef STRUCTURES_ARRAY_LIST_H
 #define STRUCTURES_ARRAY_LIST_H
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../inline_storage/inline_storage.h"
+#include "../simd_search/simd_search.h"
 
 namespace structures {
 /*!
 * \brief implementação de lista feita com vetor
+*
+* Por padrao a capacidade eh fixa e insercoes numa lista cheia lancam
+* "FULL". Com um fator de crescimento maior que 1 a lista cresce
+* geometricamente, realocando os elementos por move (ou memcpy quando T
+* eh trivialmente copiavel), de forma que push_back eh O(1) amortizado.
+*
+* O armazenamento eh alocado sem construir elementos; apenas as posicoes
+* ocupadas sao construidas (placement new) e destruidas.
+*
+* find, contains, count e remove_all usam simd_search, que compara varios
+* elementos por instrucao quando T eh aritmetico.
+*
+* Com Inline > 0 os primeiros Inline elementos ficam dentro do proprio
+* objeto (como um small_vector): o vetor de max_size elementos so eh
+* alocado quando a lista passa de Inline elementos.
 */
-template<typename T>
-class ArrayList {
+template<typename T, std::size_t Inline = 0u>
+class ArrayList : private InlineStorage<T, Inline> {
  public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
     /*!
     * \brief Construtor do ArrayList
     */
@@ -25,11 +54,53 @@ class ArrayList {
     */
     explicit ArrayList(std::size_t max_size);
 
+    /*!
+    * \brief Contrutor do ArrayList que cresce automaticamente
+    *
+    * \param max_size capacidade inicial
+    * \param growth_factor fator de crescimento; <= 1 mantem a capacidade
+    * fixa
+    */
+    ArrayList(std::size_t max_size, double growth_factor);
+
+    /*!
+    * \brief Construtor de copia, com a mesma capacidade e fator de
+    * crescimento de other
+    */
+    ArrayList(const ArrayList& other);
+
+    /*!
+    * \brief Construtor de movimento, assume o vetor de other sem alocar
+    * (os elementos inline sao movidos um a um)
+    *
+    * other fica vazia e com o mesmo max_size; o vetor dela so eh alocado
+    * de novo na proxima insercao que passar de Inline elementos.
+    */
+    ArrayList(ArrayList&& other) noexcept(NOTHROW_MOVE);
+
+    /*!
+    * \brief Atribuicao por copia
+    */
+    ArrayList& operator=(const ArrayList& other);
+
+    /*!
+    * \brief Atribuicao por movimento
+    */
+    ArrayList& operator=(ArrayList&& other) noexcept(NOTHROW_MOVE);
+
     /*!
     * \brief Destrutor do ArrayList
     */
     ~ArrayList();
 
+    /*!
+    * \brief Troca o conteudo com outro ArrayList, em O(1) se nenhum dos
+    * dois usa o espaco inline
+    *
+    * \param other
+    */
+    void swap(ArrayList& other) noexcept(NOTHROW_MOVE);
+
     /*!
     * \brief Limpa o ArrayList.
     */
@@ -42,6 +113,23 @@ class ArrayList {
     */
     void push_back(const T& data);
 
+    /*!
+    * \brief Adiciona elemento no final, movendo o dado.
+    *
+    * \param data
+    */
+    void push_back(T&& data);
+
+    /*!
+    * \brief Constroi um elemento no final a partir dos argumentos.
+    *
+    * \param args argumentos repassados ao construtor de T
+    *
+    * \return referencia do elemento construido
+    */
+    template<typename... Args>
+    T& emplace_back(Args&&... args);
+
     /*!
     * \brief Adiciona elemento no inicio.
     *
@@ -49,6 +137,23 @@ class ArrayList {
     */
     void push_front(const T& data);
 
+    /*!
+    * \brief Adiciona elemento no inicio, movendo o dado.
+    *
+    * \param data
+    */
+    void push_front(T&& data);
+
+    /*!
+    * \brief Constroi um elemento no inicio a partir dos argumentos.
+    *
+    * \param args argumentos repassados ao construtor de T
+    *
+    * \return referencia do elemento construido
+    */
+    template<typename... Args>
+    T& emplace_front(Args&&... args);
+
     /*!
     * \brief Adiciona elemento na posicao.
     *
@@ -57,12 +162,54 @@ class ArrayList {
     void insert(const T& data, std::size_t index);
 
     /*!
-    * \brief Adiciona elemento na ordem.
+    * \brief Adiciona elemento na posicao, movendo o dado.
+    *
+    * \param data, index
+    */
+    void insert(T&& data, std::size_t index);
+
+    /*!
+    * \brief Constroi um elemento na posicao a partir dos argumentos.
+    *
+    * \param index, args argumentos repassados ao construtor de T
+    *
+    * \return referencia do elemento construido
+    */
+    template<typename... Args>
+    T& emplace(std::size_t index, Args&&... args);
+
+    /*!
+    * \brief Adiciona elemento na ordem; a lista deve estar ordenada.
     *
     * \param data
     */
     void insert_sorted(const T& data);
 
+    /*!
+    * \brief Adiciona os elementos de [first, last) no final.
+    *
+    * \param first, last intervalo de iteradores de avanco
+    */
+    template<typename ForwardIt>
+    void push_back_range(ForwardIt first, ForwardIt last);
+
+    /*!
+    * \brief Adiciona os elementos de [first, last) a partir da posicao,
+    * deslocando a cauda uma unica vez.
+    *
+    * \param index, first, last intervalo de iteradores de avanco
+    */
+    template<typename ForwardIt>
+    void insert_range(std::size_t index, ForwardIt first, ForwardIt last);
+
+    /*!
+    * \brief Substitui o conteudo pelos elementos de [first, last).
+    *
+    * \param first, last intervalo de iteradores de avanco
+    */
+    template<typename ForwardIt>
+    void assign(ForwardIt first, ForwardIt last);
+
     /*!
     * \brief Remove um elemento na posicao.
     *
@@ -93,6 +240,34 @@ class ArrayList {
     */
     void remove(const T& data);
 
+    /*!
+    * \brief Remove os elementos das posicoes [first, last), deslocando a
+    * cauda uma unica vez.
+    *
+    * \param first, last
+    */
+    void erase_range(std::size_t first, std::size_t last);
+
+    /*!
+    * \brief Remove todos os elementos para os quais pred eh verdadeiro,
+    * mantendo a ordem dos demais.
+    *
+    * \param pred
+    *
+    * \return quantidade de elementos removidos
+    */
+    template<typename Predicate>
+    std::size_t erase_if(Predicate pred);
+
+    /*!
+    * \brief Remove todos os elementos iguais a data.
+    *
+    * \param data
+    *
+    * \return quantidade de elementos removidos
+    */
+    std::size_t remove_all(const T& data);
+
     /*!
     * \brief Testa se o arraylist esta vazio.
     *
@@ -125,19 +300,96 @@ class ArrayList {
     */
     std::size_t find(const T& data) const;
 
+    /*!
+    * \brief Conta as ocorrencias de um determinado dado.
+    *
+    * \param data
+    *
+    * \return quantidade de elementos iguais a data
+    */
+    std::size_t count(const T& data) const;
+
     /*!
     * \brief Retorna o tamanho do arraylist.
     *
     * \return tamanho do arraylist
     */
-    std::size_t size();
+    std::size_t size() const;
 
     /*!
     * \brief Retorna o tamanho maximo do arraylist.
     *
     * \return tamanho maximo do arraylist
     */
-    std::size_t max_size();
+    std::size_t max_size() const;
+
+    /*!
+    * \brief Garante capacidade para pelo menos new_cap elementos.
+    *
+    * \param new_cap
+    */
+    void reserve(std::size_t new_cap);
+
+    /*!
+    * \brief Reduz a capacidade ao numero de elementos armazenados.
+    */
+    void shrink_to_fit();
+
+    /*!
+    * \brief Retorna o fator de crescimento do arraylist.
+    *
+    * \return fator de crescimento, <= 1 se a capacidade for fixa
+    */
+    double growth_factor() const;
+
+    /*!
+    * \brief Altera o fator de crescimento do arraylist.
+    *
+    * \param factor novo fator; <= 1 torna a capacidade fixa
+    */
+    void growth_factor(double factor);
+
+    /*!
+    * \brief Iterador para o primeiro elemento.
+    *
+    * \return iterador para o primeiro elemento.
+    */
+    iterator begin();
+
+    /*!
+    * \brief Iterador constante para o primeiro elemento.
+    *
+    * \return iterador constante para o primeiro elemento.
+    */
+    const_iterator begin() const;
+
+    /*!
+    * \brief Iterador constante para o primeiro elemento.
+    *
+    * \return iterador constante para o primeiro elemento.
+    */
+    const_iterator cbegin() const;
+
+    /*!
+    * \brief Iterador para depois do ultimo elemento.
+    *
+    * \return iterador para o fim.
+    */
+    iterator end();
+
+    /*!
+    * \brief Iterador constante para depois do ultimo elemento.
+    *
+    * \return iterador constante para o fim.
+    */
+    const_iterator end() const;
+
+    /*!
+    * \brief Iterador constante para depois do ultimo elemento.
+    *
+    * \return iterador constante para o fim.
+    */
+    const_iterator cend() const;
 
     /*!
     * \brief Retorna o elemento na posição desejada.
@@ -176,187 +428,545 @@ class ArrayList {
     const T& operator[](std::size_t index) const;
 
  private:
+    static constexpr bool NOTHROW_MOVE =
+        Inline == 0u || std::is_nothrow_move_constructible<T>::value;
+
+    T& place(std::size_t index, T&& value);
+
+    T* storage(std::size_t count);
+
+    T* initial_storage(std::size_t count);
+
+    bool is_inline() const;
+
+    void release();
+
+    void take(ArrayList& other);
+
+    void grow(std::size_t min_cap);
+
+    void reallocate(std::size_t new_cap);
+
+    static void relocate(T* from, std::size_t count, T* to);
+
+    static T* allocate(std::size_t count);
+
+    static void deallocate(T* data);
+
     T* contents;
-    int _size;
+    std::size_t _size;
     std::size_t _max_size;
+    double _growth_factor;
 
     static const auto DEFAULT_MAX = 10u;
 };
 
-    template <class T>
-    ArrayList<T>::ArrayList() : ArrayList(DEFAULT_MAX) {}
+    template <class T, std::size_t Inline>
+    ArrayList<T, Inline>::ArrayList() : ArrayList(DEFAULT_MAX) {}
+
+    template <class T, std::size_t Inline>
+    ArrayList<T, Inline>::ArrayList(std::size_t max) : ArrayList(max, 0.0) {}
 
-    template <class T>
-    ArrayList<T>::ArrayList(std::size_t max) {
-        _size = -1;
+    template <class T, std::size_t Inline>
+    ArrayList<T, Inline>::ArrayList(std::size_t max, double growth_factor) {
+        _size = 0;
         _max_size = max;
-        contents = new T[max];
+        _growth_factor = growth_factor;
+        contents = initial_storage(0u);
     }
 
-    template <class T>
-    ArrayList<T>::~ArrayList() {
-        delete[] contents;
+    template <class T, std::size_t Inline>
+    ArrayList<T, Inline>::ArrayList(const ArrayList& other) {
+        _size = 0;
+        _max_size = other._max_size;
+        _growth_factor = other._growth_factor;
+        contents = initial_storage(other._size);
+        try {
+            std::uninitialized_copy(other.begin(), other.end(), contents);
+        } catch (...) {
+            release();
+            throw;
+        }
+        _size = other._size;
     }
 
-    template <class T>
-    void ArrayList<T>::clear() {
-        _size = -1;
+    template <class T, std::size_t Inline>
+    ArrayList<T, Inline>::ArrayList(ArrayList&& other)
+        noexcept(NOTHROW_MOVE) {
+        take(other);
     }
 
-    template <class T>
-    void ArrayList<T>::push_back(const T& data) {
-        insert(data, size());
+    template <class T, std::size_t Inline>
+    ArrayList<T, Inline>& ArrayList<T, Inline>::operator=(
+        const ArrayList& other) {
+        if (this != &other) {
+            ArrayList copy{other};
+            *this = std::move(copy);
+        }
+        return *this;
     }
 
-    template <class T>
-    void ArrayList<T>::push_front(const T& data) {
-        insert(data, 0);
+    template <class T, std::size_t Inline>
+    ArrayList<T, Inline>& ArrayList<T, Inline>::operator=(
+        ArrayList&& other) noexcept(NOTHROW_MOVE) {
+        if (this != &other) {
+            clear();
+            release();
+            take(other);
+        }
+        return *this;
     }
 
-    template <class T>
-    void ArrayList<T>::insert(const T& data, std::size_t index) {
-        if (full()) {
-            throw std::out_of_range("FULL");
-        } else {
-            ++_size;
-            if (index > _size+1 || index < 0) {
-                throw std::out_of_range("INDEX_OUT_OF_BOUNDS");
-            }
-            int atual = _size;
-            while (atual > index) {
-                contents[atual] = contents[atual-1];
-                --atual;
-            }
-            contents[index] = data;
+    template <class T, std::size_t Inline>
+    ArrayList<T, Inline>::~ArrayList() {
+        clear();
+        release();
+    }
+
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::swap(ArrayList& other) noexcept(NOTHROW_MOVE) {
+        if (is_inline() || other.is_inline()) {
+            ArrayList moved{std::move(other)};
+            other = std::move(*this);
+            *this = std::move(moved);
+            return;
         }
+        std::swap(contents, other.contents);
+        std::swap(_size, other._size);
+        std::swap(_max_size, other._max_size);
+        std::swap(_growth_factor, other._growth_factor);
+    }
+
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::clear() {
+        std::destroy(contents, contents + _size);
+        _size = 0;
+    }
+
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::push_back(const T& data) {
+        emplace(size(), data);
+    }
+
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::push_back(T&& data) {
+        emplace(size(), std::move(data));
+    }
+
+    template <class T, std::size_t Inline>
+    template <typename... Args>
+    T& ArrayList<T, Inline>::emplace_back(Args&&... args) {
+        return emplace(size(), std::forward<Args>(args)...);
+    }
+
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::push_front(const T& data) {
+        emplace(0, data);
+    }
+
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::push_front(T&& data) {
+        emplace(0, std::move(data));
+    }
+
+    template <class T, std::size_t Inline>
+    template <typename... Args>
+    T& ArrayList<T, Inline>::emplace_front(Args&&... args) {
+        return emplace(0, std::forward<Args>(args)...);
+    }
+
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::insert(const T& data, std::size_t index) {
+        emplace(index, data);
     }
 
-    template <class T>
-    void ArrayList<T>::insert_sorted(const T& data) {
-        int atual;
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::insert(T&& data, std::size_t index) {
+        emplace(index, std::move(data));
+    }
+
+    template <class T, std::size_t Inline>
+    template <typename... Args>
+    T& ArrayList<T, Inline>::emplace(std::size_t index, Args&&... args) {
+        if (index > _size) {
+            throw std::out_of_range("INDEX_OUT_OF_BOUNDS");
+        }
         if (full()) {
-            throw std::out_of_range("FULL");
-        } else {
-            atual = 0;
-            while (atual <= _size && data > contents[atual]) {
-                atual++;
+            if (_growth_factor <= 1.0) {
+                throw std::out_of_range("FULL");
             }
-            if ((_size+1) == 0) {
-                push_back(data);
-            } else {
-                insert(data, atual);
+            T value(std::forward<Args>(args)...);
+            grow(_size + 1);
+            return place(index, std::move(value));
+        }
+        if (_size == Inline && is_inline()) {
+            T value(std::forward<Args>(args)...);
+            reallocate(_max_size);
+            return place(index, std::move(value));
+        }
+        if (index == _size) {
+            new (contents + _size) T(std::forward<Args>(args)...);
+            ++_size;
+            return contents[index];
+        }
+        return place(index, T(std::forward<Args>(args)...));
+    }
+
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::insert_sorted(const T& data) {
+        // Primeira posicao com elemento >= data, por busca binaria.
+        auto position = std::lower_bound(contents, contents + _size, data);
+        insert(data, position - contents);
+    }
+
+    template <class T, std::size_t Inline>
+    template <typename ForwardIt>
+    void ArrayList<T, Inline>::push_back_range(ForwardIt first,
+                                               ForwardIt last) {
+        insert_range(_size, first, last);
+    }
+
+    template <class T, std::size_t Inline>
+    template <typename ForwardIt>
+    void ArrayList<T, Inline>::insert_range(std::size_t index, ForwardIt first,
+                                    ForwardIt last) {
+        if (index > _size) {
+            throw std::out_of_range("INDEX_OUT_OF_BOUNDS");
+        }
+        auto count = static_cast<std::size_t>(std::distance(first, last));
+        if (count == 0) {
+            return;
+        }
+        if (_size + count > _max_size) {
+            if (_growth_factor <= 1.0) {
+                throw std::out_of_range("FULL");
             }
+            grow(_size + count);
+        } else if (_size + count > Inline && is_inline()) {
+            reallocate(_max_size);
+        }
+        auto position = contents + index;
+        auto old_end = contents + _size;
+        auto tail = _size - index;
+        if (tail > count) {
+            // A cauda passa do fim: os ultimos count vao para posicoes nao
+            // construidas e o resto eh deslocado por atribuicao.
+            std::uninitialized_move(old_end - count, old_end, old_end);
+            std::move_backward(position, old_end - count, old_end);
+            std::copy(first, last, position);
+        } else {
+            auto middle = first;
+            std::advance(middle, tail);
+            std::uninitialized_copy(middle, last, old_end);
+            std::uninitialized_move(position, old_end, position + count);
+            std::copy(first, middle, position);
         }
+        _size += count;
+    }
+
+    template <class T, std::size_t Inline>
+    template <typename ForwardIt>
+    void ArrayList<T, Inline>::assign(ForwardIt first, ForwardIt last) {
+        clear();
+        push_back_range(first, last);
     }
 
-    template <class T>
-    T ArrayList<T>::pop(std::size_t index) {
+    template <class T, std::size_t Inline>
+    T ArrayList<T, Inline>::pop(std::size_t index) {
         if (empty()) {
             throw std::out_of_range("EMPTY");
-        } else if (index > _size || index >= -1) {
+        } else if (index >= _size) {
             throw std::out_of_range("INDEX_OUT_OF_BOUNDS");
         }
-        auto data = contents[index];
+        auto data = std::move(contents[index]);
+        std::move(contents + index + 1, contents + _size, contents + index);
+        std::destroy_at(contents + _size - 1);
         --_size;
-        for (auto i = index; i < size(); i++) {
-            contents[i] = contents[i+1];
-        }
         return data;
     }
 
-    template <class T>
-    T ArrayList<T>::pop_back() {
-        return pop(_size);
+    template <class T, std::size_t Inline>
+    T ArrayList<T, Inline>::pop_back() {
+        if (empty()) {
+            throw std::out_of_range("EMPTY");
+        }
+        return pop(_size - 1);
     }
 
-    template <class T>
-    T ArrayList<T>::pop_front() {
+    template <class T, std::size_t Inline>
+    T ArrayList<T, Inline>::pop_front() {
         return pop(0);
     }
 
-    template <class T>
-    void ArrayList<T>::remove(const T& data) {
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::remove(const T& data) {
         if (empty()) {
-            std::out_of_range("EMPTY");
-        } else if (!contains(data)) {
-            std::out_of_range("DO NOT CONTAIN");
-        } else {
-            for (auto i = 0; i < _size-1; i++) {
-                if (contents[i] == data) {
-                    contents[i] = contents[i+1];
-                    break;
-                }
-            }
-            --_size;
+            throw std::out_of_range("EMPTY");
         }
+        auto index = find(data);
+        if (index == _size) {
+            throw std::out_of_range("DO NOT CONTAIN");
+        }
+        pop(index);
     }
 
-    template <class T>
-    bool ArrayList<T>::full() const {
-        return _size == _max_size-1;
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::erase_range(std::size_t first,
+                                           std::size_t last) {
+        if (first > last || last > _size) {
+            throw std::out_of_range("INDEX_OUT_OF_BOUNDS");
+        }
+        auto new_end = std::move(contents + last, contents + _size,
+                                 contents + first);
+        std::destroy(new_end, contents + _size);
+        _size -= last - first;
     }
 
-    template <class T>
-    bool ArrayList<T>::empty() const {
-        return _size == -1;
+    template <class T, std::size_t Inline>
+    template <typename Predicate>
+    std::size_t ArrayList<T, Inline>::erase_if(Predicate pred) {
+        auto new_end = std::remove_if(contents, contents + _size, pred);
+        auto removed = static_cast<std::size_t>(contents + _size - new_end);
+        std::destroy(new_end, contents + _size);
+        _size -= removed;
+        return removed;
     }
 
-    template <class T>
-    bool ArrayList<T>::contains(const T& data) const {
-        return find(data) < _size;
+    template <class T, std::size_t Inline>
+    std::size_t ArrayList<T, Inline>::remove_all(const T& data) {
+        auto new_size = simd::remove(contents, _size, data);
+        auto removed = _size - new_size;
+        std::destroy(contents + new_size, contents + _size);
+        _size = new_size;
+        return removed;
     }
 
-    template <class T>
-    std::size_t ArrayList<T>::find(const T &data) const {
-        std::size_t index;
+    template <class T, std::size_t Inline>
+    bool ArrayList<T, Inline>::full() const {
+        return _size == _max_size;
+    }
+
+    template <class T, std::size_t Inline>
+    bool ArrayList<T, Inline>::empty() const {
+        return _size == 0;
+    }
+
+    template <class T, std::size_t Inline>
+    bool ArrayList<T, Inline>::contains(const T& data) const {
+        return !empty() && find(data) < _size;
+    }
+
+    template <class T, std::size_t Inline>
+    std::size_t ArrayList<T, Inline>::find(const T &data) const {
         if (empty()) {
             throw std::out_of_range("EMPTY");
-        } else {
-            for (index = 0; index < _size+1; index++) {
-                if (contents[index] == data) {
-                    break;
-                }
-            }
         }
-        return index;
+        return simd::find(contents, _size, data);
+    }
+
+    template <class T, std::size_t Inline>
+    std::size_t ArrayList<T, Inline>::count(const T& data) const {
+        return simd::count(contents, _size, data);
     }
 
-    template <class T>
-    std::size_t ArrayList<T>::size() {
-        return _size+1;
+    template <class T, std::size_t Inline>
+    std::size_t ArrayList<T, Inline>::size() const {
+        return _size;
     }
 
-    template <class T>
-    std::size_t ArrayList<T>::max_size() {
+    template <class T, std::size_t Inline>
+    std::size_t ArrayList<T, Inline>::max_size() const {
         return _max_size;
     }
 
-    template <class T>
-    T& ArrayList<T>::at(std::size_t index) {
-        if (index < 0 || index >= -1) {
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::reserve(std::size_t new_cap) {
+        if (new_cap > _max_size) {
+            reallocate(new_cap);
+        }
+    }
+
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::shrink_to_fit() {
+        if (_size < _max_size) {
+            reallocate(_size);
+        }
+    }
+
+    template <class T, std::size_t Inline>
+    double ArrayList<T, Inline>::growth_factor() const {
+        return _growth_factor;
+    }
+
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::growth_factor(double factor) {
+        _growth_factor = factor;
+    }
+
+    template <class T, std::size_t Inline>
+    T& ArrayList<T, Inline>::at(std::size_t index) {
+        if (index >= _size) {
             throw std::out_of_range("INDEX_OUT_OF_BOUNDS");
         }
         return contents[index];
     }
 
-    template <class T>
-    T& ArrayList<T>::operator[](std::size_t index) {
+    template <class T, std::size_t Inline>
+    T& ArrayList<T, Inline>::operator[](std::size_t index) {
         return at(index);
     }
 
-    template <class T>
-    const T& ArrayList<T>::at(std::size_t index) const {
-        if (index < 0 || index >= -1) {
+    template <class T, std::size_t Inline>
+    const T& ArrayList<T, Inline>::at(std::size_t index) const {
+        if (index >= _size) {
             throw std::out_of_range("INDEX_OUT_OF_BOUNDS");
         }
         return contents[index];
     }
 
-    template <class T>
-    const T& ArrayList<T>::operator[](std::size_t index) const {
+    template <class T, std::size_t Inline>
+    const T& ArrayList<T, Inline>::operator[](std::size_t index) const {
         return at(index);
     }
 
+    template <class T, std::size_t Inline>
+    typename ArrayList<T, Inline>::iterator
+    ArrayList<T, Inline>::begin() {
+        return contents;
+    }
+
+    template <class T, std::size_t Inline>
+    typename ArrayList<T, Inline>::const_iterator
+    ArrayList<T, Inline>::begin() const {
+        return contents;
+    }
+
+    template <class T, std::size_t Inline>
+    typename ArrayList<T, Inline>::const_iterator
+    ArrayList<T, Inline>::cbegin() const {
+        return contents;
+    }
+
+    template <class T, std::size_t Inline>
+    typename ArrayList<T, Inline>::iterator
+    ArrayList<T, Inline>::end() {
+        return contents + _size;
+    }
+
+    template <class T, std::size_t Inline>
+    typename ArrayList<T, Inline>::const_iterator
+    ArrayList<T, Inline>::end() const {
+        return contents + _size;
+    }
+
+    template <class T, std::size_t Inline>
+    typename ArrayList<T, Inline>::const_iterator
+    ArrayList<T, Inline>::cend() const {
+        return contents + _size;
+    }
+
+    template <class T, std::size_t Inline>
+    T& ArrayList<T, Inline>::place(std::size_t index, T&& value) {
+        if (index == _size) {
+            new (contents + _size) T(std::move(value));
+        } else {
+            new (contents + _size) T(std::move(contents[_size - 1]));
+            std::move_backward(contents + index, contents + _size - 1,
+                               contents + _size);
+            contents[index] = std::move(value);
+        }
+        ++_size;
+        return contents[index];
+    }
+
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::grow(std::size_t min_cap) {
+        auto new_cap = static_cast<std::size_t>(_max_size * _growth_factor);
+        if (new_cap < min_cap) {
+            new_cap = min_cap;
+        }
+        reallocate(new_cap);
+    }
+
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::reallocate(std::size_t new_cap) {
+        auto new_contents = storage(new_cap);
+        if (new_contents != contents) {
+            relocate(contents, _size, new_contents);
+            release();
+            contents = new_contents;
+        }
+        _max_size = new_cap;
+    }
+
+    template <class T, std::size_t Inline>
+    T* ArrayList<T, Inline>::storage(std::size_t count) {
+        return count <= Inline ? this->inline_data() : allocate(count);
+    }
+
+    template <class T, std::size_t Inline>
+    T* ArrayList<T, Inline>::initial_storage(std::size_t count) {
+        // O vetor de _max_size elementos fica para a primeira insercao que
+        // passar de Inline elementos.
+        if (Inline > 0u && count <= Inline) {
+            return this->inline_data();
+        }
+        return storage(_max_size);
+    }
+
+    template <class T, std::size_t Inline>
+    bool ArrayList<T, Inline>::is_inline() const {
+        // Com Inline = 0, uma lista sem vetor (movida) conta como inline.
+        return contents == this->inline_data();
+    }
+
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::release() {
+        if (!is_inline()) {
+            deallocate(contents);
+        }
+    }
+
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::take(ArrayList& other) {
+        // Pre-condicao: esta lista esta vazia e nao tem memoria no heap.
+        _size = 0;
+        _max_size = other._max_size;
+        _growth_factor = other._growth_factor;
+        if (other.is_inline()) {
+            contents = this->inline_data();
+            std::uninitialized_move(other.begin(), other.end(), contents);
+            _size = other._size;
+            other.clear();
+        } else {
+            contents = std::exchange(other.contents, other.inline_data());
+            _size = std::exchange(other._size, 0u);
+        }
+    }
+
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::relocate(T* from, std::size_t count, T* to) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (count > 0) {
+                std::memcpy(to, from, count * sizeof(T));
+            }
+        } else {
+            std::uninitialized_move(from, from + count, to);
+            std::destroy(from, from + count);
+        }
+    }
+
+    template <class T, std::size_t Inline>
+    T* ArrayList<T, Inline>::allocate(std::size_t count) {
+        return static_cast<T*>(::operator new(count * sizeof(T),
+                                              std::align_val_t{alignof(T)}));
+    }
+
+    template <class T, std::size_t Inline>
+    void ArrayList<T, Inline>::deallocate(T* data) {
+        ::operator delete(data, std::align_val_t{alignof(T)});
+    }
+
 }  // namespace structures
 
 #endif
@@ -3,22 +3,99 @@
 #ifndef STRUCTURES_ARRAY_QUEUE_H
 #define STRUCTURES_ARRAY_QUEUE_H
 
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace structures {
 
 /*!
  *  \brief A classe ArrayQueue eh uma implementacao de uma fila(FIFO)
  *
+ *  Os elementos sao guardados num buffer circular indexado por inicio e
+ *  fim, de modo que enqueue e dequeue sao O(1) e tocam apenas uma posicao.
+ *  Com PowerOfTwo = true a capacidade eh arredondada para a proxima
+ *  potencia de dois e o avanco dos indices usa mascara em vez de
+ *  comparacao. O armazenamento eh alocado sem construir elementos; apenas
+ *  as posicoes ocupadas sao construidas e destruidas.
+ *
  *  \sa ArrayQueue(), ArrayQueue(std::size_t max), ~ArrayQueue(), 
  *  \sa enqueue(const T& data), dequeue(), back(), clear(), size(), 
  *  \sa maz_size(), empty() and full().
  */
 
-template<class T>
+template<class T, bool PowerOfTwo = false>
 class ArrayQueue {
  public:
+    /*!
+     *  \brief Iterador de avanco do inicio para o final da fila.
+     *
+     *  U eh T ou const T.
+     */
+    template<typename U>
+    class Iterator {
+     public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = U*;
+        using reference = U&;
+
+        Iterator() = default;
+
+        Iterator(U* contents, std::size_t max_size, std::size_t slot,
+                 std::size_t offset):
+            contents_{contents}, max_size_{max_size}, slot_{slot},
+            offset_{offset} {}
+
+        template<typename V, typename = typename std::enable_if<
+            std::is_convertible<V*, U*>::value>::type>
+        Iterator(const Iterator<V>& other):  // NOLINT
+            contents_{other.contents_}, max_size_{other.max_size_},
+            slot_{other.slot_}, offset_{other.offset_} {}
+
+        reference operator*() const { return contents_[slot_]; }
+
+        pointer operator->() const { return contents_ + slot_; }
+
+        Iterator& operator++() {
+            slot_ = slot_ + 1 == max_size_ ? 0 : slot_ + 1;
+            ++offset_;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return offset_ == other.offset_;
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return offset_ != other.offset_;
+        }
+
+     private:
+        template<typename> friend class Iterator;
+
+        U* contents_{nullptr};
+        std::size_t max_size_{0u};
+        std::size_t slot_{0u};
+        std::size_t offset_{0u};
+    };
+
+    using value_type = T;
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+
     /*!
      *  \brief Construtor da fila com tamanho especificado.
      */
@@ -31,11 +108,40 @@ class ArrayQueue {
      */
     explicit ArrayQueue(std::size_t max);
 
+    /*!
+     *  \brief Construtor de copia, aloca a mesma capacidade de other e
+     *  guarda os elementos a partir da posicao 0.
+     */
+    ArrayQueue(const ArrayQueue& other);
+
+    /*!
+     *  \brief Construtor de movimento, assume o buffer de other sem alocar.
+     *
+     *  other fica vazia e com a mesma capacidade; o buffer dela so eh
+     *  alocado de novo no proximo enqueue.
+     */
+    ArrayQueue(ArrayQueue&& other) noexcept;
+
+    /*!
+     *  \brief Atribuicao por copia.
+     */
+    ArrayQueue& operator=(const ArrayQueue& other);
+
+    /*!
+     *  \brief Atribuicao por movimento.
+     */
+    ArrayQueue& operator=(ArrayQueue&& other) noexcept;
+
     /*!
      *  \brief Destrutor da fila.
      */
     ~ArrayQueue();
 
+    /*!
+     *  \brief swap troca o conteudo com outra fila em O(1).
+     */
+    void swap(ArrayQueue& other) noexcept;
+
     /*!
      *  \brief enqueue adiciona um novo elemento tipo T ao final da fila.
      *
@@ -43,6 +149,24 @@ class ArrayQueue {
      */
     void enqueue(const T& data);
 
+    /*!
+     *  \brief enqueue adiciona um novo elemento ao final da fila, movendo o
+     *  dado.
+     *
+     *  \param data dado a ser armazenado na fila.
+     */
+    void enqueue(T&& data);
+
+    /*!
+     *  \brief emplace constroi um novo elemento no final da fila.
+     *
+     *  \param args argumentos repassados ao construtor de T.
+     *
+     *  \return a referencia do elemento construido.
+     */
+    template<typename... Args>
+    T& emplace(Args&&... args);
+
     /*!
      *  \brief dequeue remove o primeiro elemento da fila.
      *
@@ -92,78 +216,283 @@ class ArrayQueue {
      */
     bool full();
 
+    /*!
+     *  \brief begin retorna um iterador para o inicio da fila.
+     *
+     *  \return iterador para o primeiro elemento.
+     */
+    iterator begin();
+
+    /*!
+     *  \brief begin retorna um iterador constante para o inicio da fila.
+     *
+     *  \return iterador constante para o primeiro elemento.
+     */
+    const_iterator begin() const;
+
+    /*!
+     *  \brief cbegin retorna um iterador constante para o inicio da fila.
+     *
+     *  \return iterador constante para o primeiro elemento.
+     */
+    const_iterator cbegin() const;
+
+    /*!
+     *  \brief end retorna um iterador para depois do final da fila.
+     *
+     *  \return iterador para o fim.
+     */
+    iterator end();
+
+    /*!
+     *  \brief end retorna um iterador constante para depois do final.
+     *
+     *  \return iterador constante para o fim.
+     */
+    const_iterator end() const;
+
+    /*!
+     *  \brief cend retorna um iterador constante para depois do final.
+     *
+     *  \return iterador constante para o fim.
+     */
+    const_iterator cend() const;
+
  private:
+    std::size_t next(std::size_t index) const;
+
+    std::size_t prev(std::size_t index) const;
+
+    static std::size_t round_capacity(std::size_t max);
+
+    static T* allocate(std::size_t count);
+
+    static void deallocate(T* data);
+
     T* contents;
+    std::size_t _begin;
+    std::size_t _end;
     std::size_t _size;
     std::size_t _max_size;
 
     static const auto DEFAULT_SIZE = 10u;
 };
 
-template <class T>
-ArrayQueue<T>::ArrayQueue() : ArrayQueue(DEFAULT_SIZE) {}
+template <class T, bool PowerOfTwo>
+ArrayQueue<T, PowerOfTwo>::ArrayQueue() : ArrayQueue(DEFAULT_SIZE) {}
+
+template <class T, bool PowerOfTwo>
+ArrayQueue<T, PowerOfTwo>::ArrayQueue(std::size_t max) {
+    _max_size = round_capacity(max);
+    _begin = 0;
+    _end = 0;
+    _size = 0;
+    contents = allocate(_max_size);
+}
+
+template <class T, bool PowerOfTwo>
+ArrayQueue<T, PowerOfTwo>::ArrayQueue(const ArrayQueue& other) {
+    _max_size = other._max_size;
+    _begin = 0;
+    _end = 0;
+    _size = 0;
+    contents = allocate(_max_size);
+    try {
+        std::uninitialized_copy(other.begin(), other.end(), contents);
+    } catch (...) {
+        deallocate(contents);
+        throw;
+    }
+    _size = other._size;
+    _end = _size == _max_size ? 0 : _size;
+}
+
+template <class T, bool PowerOfTwo>
+ArrayQueue<T, PowerOfTwo>::ArrayQueue(ArrayQueue&& other) noexcept :
+    contents{std::exchange(other.contents, nullptr)},
+    _begin{std::exchange(other._begin, 0u)},
+    _end{std::exchange(other._end, 0u)},
+    _size{std::exchange(other._size, 0u)},
+    _max_size{other._max_size}
+{}
+
+template <class T, bool PowerOfTwo>
+ArrayQueue<T, PowerOfTwo>& ArrayQueue<T, PowerOfTwo>::operator=(
+    const ArrayQueue& other) {
+    if (this != &other) {
+        ArrayQueue copy{other};
+        swap(copy);
+    }
+    return *this;
+}
+
+template <class T, bool PowerOfTwo>
+ArrayQueue<T, PowerOfTwo>& ArrayQueue<T, PowerOfTwo>::operator=(
+    ArrayQueue&& other) noexcept {
+    if (this != &other) {
+        ArrayQueue moved{std::move(other)};
+        swap(moved);
+    }
+    return *this;
+}
+
+template <class T, bool PowerOfTwo>
+ArrayQueue<T, PowerOfTwo>::~ArrayQueue() {
+    clear();
+    deallocate(contents);
+}
+
+template <class T, bool PowerOfTwo>
+void ArrayQueue<T, PowerOfTwo>::swap(ArrayQueue& other) noexcept {
+    std::swap(contents, other.contents);
+    std::swap(_begin, other._begin);
+    std::swap(_end, other._end);
+    std::swap(_size, other._size);
+    std::swap(_max_size, other._max_size);
+}
 
-template <class T>
-ArrayQueue<T>::ArrayQueue(std::size_t max) {
-    _max_size = max;
-    _size = -1;
-    contents = new T[_max_size];
+template <class T, bool PowerOfTwo>
+void ArrayQueue<T, PowerOfTwo>::enqueue(const T& data) {
+    emplace(data);
 }
 
-template <class T>
-ArrayQueue<T>::~ArrayQueue() {
-    delete[] contents;
+template <class T, bool PowerOfTwo>
+void ArrayQueue<T, PowerOfTwo>::enqueue(T&& data) {
+    emplace(std::move(data));
 }
 
-template <class T>
-void ArrayQueue<T>::enqueue(const T& data) {
+template <class T, bool PowerOfTwo>
+template <typename... Args>
+T& ArrayQueue<T, PowerOfTwo>::emplace(Args&&... args) {
     if (full())
         throw std::out_of_range("full ArrayQueue");
-    contents[++_size] = data;
+    if (contents == nullptr)
+        contents = allocate(_max_size);
+    auto slot = contents + _end;
+    new (slot) T(std::forward<Args>(args)...);
+    _end = next(_end);
+    _size++;
+    return *slot;
 }
 
-template <class T>
-T ArrayQueue<T>::dequeue() {
+template <class T, bool PowerOfTwo>
+T ArrayQueue<T, PowerOfTwo>::dequeue() {
     if (empty())
         throw std::out_of_range("empty ArrayQueue");
-    auto data = contents[0];
-    for (int i = 0; i < _max_size - 1; i++) {
-        contents[i] = contents[i+1];
-    }
+    auto data = std::move(contents[_begin]);
+    std::destroy_at(contents + _begin);
+    _begin = next(_begin);
     _size--;
     return data;
 }
 
-template <class T>
-T& ArrayQueue<T>::back() {
+template <class T, bool PowerOfTwo>
+T& ArrayQueue<T, PowerOfTwo>::back() {
     if (empty())
         throw std::out_of_range("empty ArrayQueue");
-    return contents[_size];
+    return contents[prev(_end)];
 }
 
-template <class T>
-void ArrayQueue<T>::clear() {
-    _size = -1;
+template <class T, bool PowerOfTwo>
+void ArrayQueue<T, PowerOfTwo>::clear() {
+    for (; _size > 0; _size--) {
+        std::destroy_at(contents + _begin);
+        _begin = next(_begin);
+    }
+    _begin = 0;
+    _end = 0;
+    _size = 0;
 }
 
-template <class T>
-std::size_t ArrayQueue<T>::size() {
-    return _size + 1;
+template <class T, bool PowerOfTwo>
+std::size_t ArrayQueue<T, PowerOfTwo>::size() {
+    return _size;
 }
 
-template <class T>
-std::size_t ArrayQueue<T>::max_size() {
+template <class T, bool PowerOfTwo>
+std::size_t ArrayQueue<T, PowerOfTwo>::max_size() {
     return _max_size;
 }
 
-template <class T>
-bool ArrayQueue<T>::empty() {
-    return _size == -1;
+template <class T, bool PowerOfTwo>
+bool ArrayQueue<T, PowerOfTwo>::empty() {
+    return _size == 0;
+}
+
+template <class T, bool PowerOfTwo>
+bool ArrayQueue<T, PowerOfTwo>::full() {
+    return _size == _max_size;
+}
+
+template <class T, bool PowerOfTwo>
+typename ArrayQueue<T, PowerOfTwo>::iterator
+ArrayQueue<T, PowerOfTwo>::begin() {
+    return iterator{contents, _max_size, _begin, 0u};
+}
+
+template <class T, bool PowerOfTwo>
+typename ArrayQueue<T, PowerOfTwo>::const_iterator
+ArrayQueue<T, PowerOfTwo>::begin() const {
+    return const_iterator{contents, _max_size, _begin, 0u};
+}
+
+template <class T, bool PowerOfTwo>
+typename ArrayQueue<T, PowerOfTwo>::const_iterator
+ArrayQueue<T, PowerOfTwo>::cbegin() const {
+    return begin();
+}
+
+template <class T, bool PowerOfTwo>
+typename ArrayQueue<T, PowerOfTwo>::iterator
+ArrayQueue<T, PowerOfTwo>::end() {
+    return iterator{contents, _max_size, _end, _size};
+}
+
+template <class T, bool PowerOfTwo>
+typename ArrayQueue<T, PowerOfTwo>::const_iterator
+ArrayQueue<T, PowerOfTwo>::end() const {
+    return const_iterator{contents, _max_size, _end, _size};
+}
+
+template <class T, bool PowerOfTwo>
+typename ArrayQueue<T, PowerOfTwo>::const_iterator
+ArrayQueue<T, PowerOfTwo>::cend() const {
+    return end();
+}
+
+template <class T, bool PowerOfTwo>
+std::size_t ArrayQueue<T, PowerOfTwo>::next(std::size_t index) const {
+    if (PowerOfTwo)
+        return (index + 1) & (_max_size - 1);
+    return index + 1 == _max_size ? 0 : index + 1;
+}
+
+template <class T, bool PowerOfTwo>
+std::size_t ArrayQueue<T, PowerOfTwo>::prev(std::size_t index) const {
+    if (PowerOfTwo)
+        return (index - 1) & (_max_size - 1);
+    return (index == 0 ? _max_size : index) - 1;
+}
+
+template <class T, bool PowerOfTwo>
+std::size_t ArrayQueue<T, PowerOfTwo>::round_capacity(std::size_t max) {
+    if (!PowerOfTwo)
+        return max;
+    std::size_t capacity = 1;
+    while (capacity < max)
+        capacity <<= 1;
+    return capacity;
+}
+
+template <class T, bool PowerOfTwo>
+T* ArrayQueue<T, PowerOfTwo>::allocate(std::size_t count) {
+    return static_cast<T*>(::operator new(count * sizeof(T),
+                                          std::align_val_t{alignof(T)}));
 }
 
-template <class T>
-bool ArrayQueue<T>::full() {
-    return _size == max_size() - 1;
+template <class T, bool PowerOfTwo>
+void ArrayQueue<T, PowerOfTwo>::deallocate(T* data) {
+    ::operator delete(data, std::align_val_t{alignof(T)});
 }
 
 }  // namespace structures
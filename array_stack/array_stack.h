@@ -4,7 +4,13 @@
 #define STRUCTURES_ARRAY_STACK_H
 
 #include <cstdint>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../inline_storage/inline_storage.h"
 
 namespace structures {
 
@@ -14,11 +20,23 @@ namespace structures {
  *  \sa ArrayStack(), ArrayStack(std::size_t max), ~ArrayStack(),
  *  \sa push(const T& data), pop(), top(), clear(), size(),
  *  \sa maz_size(), empty() and full().
+ *
+ *  O armazenamento eh alocado sem construir elementos; apenas as posicoes
+ *  ocupadas sao construidas e destruidas.
+ *
+ *  Com Inline > 0 os primeiros Inline elementos ficam dentro do proprio
+ *  objeto: o vetor de max_size elementos so eh alocado quando a pilha
+ *  passa de Inline elementos, entao uma pilha que fica pequena nao aloca
+ *  mesmo com um max_size grande.
  */
 
-template<class T>
-class ArrayStack {
+template<class T, std::size_t Inline = 0u>
+class ArrayStack : private InlineStorage<T, Inline> {
  public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+
     /*!
     *  \brief Construtor da pilha com tamanho especificado.
     */
@@ -31,11 +49,41 @@ class ArrayStack {
     */
     explicit ArrayStack(std::size_t max);
 
+    /*!
+    *  \brief Construtor de copia, com a mesma capacidade de other.
+    */
+    ArrayStack(const ArrayStack& other);
+
+    /*!
+    *  \brief Construtor de movimento, assume o vetor de other sem alocar
+    *  (os elementos inline sao movidos um a um).
+    *
+    *  other fica vazia e com o mesmo max_size; o vetor dela so eh alocado
+    *  de novo no proximo push que passar de Inline elementos.
+    */
+    ArrayStack(ArrayStack&& other) noexcept(NOTHROW_MOVE);
+
+    /*!
+    *  \brief Atribuicao por copia.
+    */
+    ArrayStack& operator=(const ArrayStack& other);
+
+    /*!
+    *  \brief Atribuicao por movimento.
+    */
+    ArrayStack& operator=(ArrayStack&& other) noexcept(NOTHROW_MOVE);
+
     /*!
     *  \brief Destrutor da pilha.
     */
     ~ArrayStack();
 
+    /*!
+    *  \brief swap troca o conteudo com outra pilha, em O(1) se nenhuma
+    *  das duas usa o espaco inline.
+    */
+    void swap(ArrayStack& other) noexcept(NOTHROW_MOVE);
+
     /*!
     *  \brief push adiciona um novo elemento tipo T ao final da pilha.
     *
@@ -43,6 +91,23 @@ class ArrayStack {
     */
     void push(const T& data);
 
+    /*!
+    *  \brief push adiciona um novo elemento ao final da pilha, movendo o dado.
+    *
+    *  \param data dado a ser armazenado na pilha.
+    */
+    void push(T&& data);
+
+    /*!
+    *  \brief emplace constroi um novo elemento no final da pilha.
+    *
+    *  \param args argumentos repassados ao construtor de T.
+    *
+    *  \return a referencia do elemento construido.
+    */
+    template<typename... Args>
+    T& emplace(Args&&... args);
+
     /*!
     *  \brief pop remove o primeiro elemento da pilha.
     *
@@ -91,7 +156,66 @@ class ArrayStack {
     */
     bool full();
 
+    /*!
+    *  \brief begin retorna um iterador para a base da pilha.
+    *
+    *  \return iterador para o primeiro elemento empilhado.
+    */
+    iterator begin();
+
+    /*!
+    *  \brief begin retorna um iterador constante para a base da pilha.
+    *
+    *  \return iterador constante para o primeiro elemento empilhado.
+    */
+    const_iterator begin() const;
+
+    /*!
+    *  \brief cbegin retorna um iterador constante para a base da pilha.
+    *
+    *  \return iterador constante para o primeiro elemento empilhado.
+    */
+    const_iterator cbegin() const;
+
+    /*!
+    *  \brief end retorna um iterador para depois do topo da pilha.
+    *
+    *  \return iterador para o fim.
+    */
+    iterator end();
+
+    /*!
+    *  \brief end retorna um iterador constante para depois do topo.
+    *
+    *  \return iterador constante para o fim.
+    */
+    const_iterator end() const;
+
+    /*!
+    *  \brief cend retorna um iterador constante para depois do topo.
+    *
+    *  \return iterador constante para o fim.
+    */
+    const_iterator cend() const;
+
  private:
+    static constexpr bool NOTHROW_MOVE =
+        Inline == 0u || std::is_nothrow_move_constructible<T>::value;
+
+    T* initial_storage(std::size_t count);
+
+    bool is_inline() const;
+
+    void spill();
+
+    void release();
+
+    void take(ArrayStack& other);
+
+    static T* allocate(std::size_t count);
+
+    static void deallocate(T* data);
+
     T* contents;
     int _top;
     std::size_t _max_size;
@@ -99,65 +223,239 @@ class ArrayStack {
     static const auto DEFAULT_SIZE = 10u;
 };
 
-template <class T>
-ArrayStack<T>::ArrayStack() : ArrayStack(DEFAULT_SIZE) {}
+template <class T, std::size_t Inline>
+ArrayStack<T, Inline>::ArrayStack() : ArrayStack(DEFAULT_SIZE) {}
 
-template <class T>
-ArrayStack<T>::ArrayStack(std::size_t max) {
+template <class T, std::size_t Inline>
+ArrayStack<T, Inline>::ArrayStack(std::size_t max) {
     _max_size = max;
     _top = -1;
-    contents = new T[_max_size];
+    contents = initial_storage(0u);
+}
+
+template <class T, std::size_t Inline>
+ArrayStack<T, Inline>::ArrayStack(const ArrayStack& other) {
+    _max_size = other._max_size;
+    _top = -1;
+    contents = initial_storage(other._top + 1);
+    try {
+        std::uninitialized_copy(other.begin(), other.end(), contents);
+    } catch (...) {
+        release();
+        throw;
+    }
+    _top = other._top;
 }
 
-template <class T>
-ArrayStack<T>::~ArrayStack() {
-    delete[] contents;
+template <class T, std::size_t Inline>
+ArrayStack<T, Inline>::ArrayStack(ArrayStack&& other) noexcept(NOTHROW_MOVE) {
+    take(other);
 }
 
-template <class T>
-void ArrayStack<T>::push(const T& data) {
+template <class T, std::size_t Inline>
+ArrayStack<T, Inline>& ArrayStack<T, Inline>::operator=(
+    const ArrayStack& other) {
+    if (this != &other) {
+        ArrayStack copy{other};
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+template <class T, std::size_t Inline>
+ArrayStack<T, Inline>& ArrayStack<T, Inline>::operator=(
+    ArrayStack&& other) noexcept(NOTHROW_MOVE) {
+    if (this != &other) {
+        clear();
+        release();
+        take(other);
+    }
+    return *this;
+}
+
+template <class T, std::size_t Inline>
+ArrayStack<T, Inline>::~ArrayStack() {
+    clear();
+    release();
+}
+
+template <class T, std::size_t Inline>
+void ArrayStack<T, Inline>::swap(ArrayStack& other) noexcept(NOTHROW_MOVE) {
+    if (is_inline() || other.is_inline()) {
+        ArrayStack moved{std::move(other)};
+        other = std::move(*this);
+        *this = std::move(moved);
+        return;
+    }
+    std::swap(contents, other.contents);
+    std::swap(_top, other._top);
+    std::swap(_max_size, other._max_size);
+}
+
+template <class T, std::size_t Inline>
+void ArrayStack<T, Inline>::push(const T& data) {
+    emplace(data);
+}
+
+template <class T, std::size_t Inline>
+void ArrayStack<T, Inline>::push(T&& data) {
+    emplace(std::move(data));
+}
+
+template <class T, std::size_t Inline>
+template <typename... Args>
+T& ArrayStack<T, Inline>::emplace(Args&&... args) {
     if (full())
         throw std::out_of_range("ArrayStack<>::push(T& data): full ArrayStack");
-    contents[++_top] = data;
+    if (size() == Inline && is_inline()) {
+        // args pode referenciar um elemento que spill() vai mover.
+        T value(std::forward<Args>(args)...);
+        spill();
+        new (contents + _top + 1) T(std::move(value));
+        return contents[++_top];
+    }
+    new (contents + _top + 1) T(std::forward<Args>(args)...);
+    return contents[++_top];
 }
 
-template <class T>
-T ArrayStack<T>::pop() {
+template <class T, std::size_t Inline>
+T ArrayStack<T, Inline>::pop() {
     if (empty())
         throw std::out_of_range("ArrayStack<>::pop(): empty ArrayStack");
-    return contents[--_top + 1];
+    auto data = std::move(contents[_top]);
+    std::destroy_at(contents + _top);
+    --_top;
+    return data;
 }
 
-template <class T>
-T& ArrayStack<T>::top() {
+template <class T, std::size_t Inline>
+T& ArrayStack<T, Inline>::top() {
     if (empty())
         throw std::out_of_range("ArrayStack<>::top(): empty ArrayStack");
     return contents[_top];
 }
 
-template <class T>
-void ArrayStack<T>::clear() {
+template <class T, std::size_t Inline>
+void ArrayStack<T, Inline>::clear() {
+    std::destroy(contents, contents + size());
     _top = -1;
 }
 
-template <class T>
-std::size_t ArrayStack<T>::size() {
+template <class T, std::size_t Inline>
+std::size_t ArrayStack<T, Inline>::size() {
     return _top + 1;
 }
 
-template <class T>
-std::size_t ArrayStack<T>::max_size() {
+template <class T, std::size_t Inline>
+std::size_t ArrayStack<T, Inline>::max_size() {
     return _max_size;
 }
 
-template <class T>
-bool ArrayStack<T>::empty() {
+template <class T, std::size_t Inline>
+bool ArrayStack<T, Inline>::empty() {
     return _top == -1;
 }
 
-template <class T>
-bool ArrayStack<T>::full() {
-    return _top == max_size() - 1;
+template <class T, std::size_t Inline>
+bool ArrayStack<T, Inline>::full() {
+    return size() == max_size();
+}
+
+template <class T, std::size_t Inline>
+typename ArrayStack<T, Inline>::iterator
+ArrayStack<T, Inline>::begin() {
+    return contents;
+}
+
+template <class T, std::size_t Inline>
+typename ArrayStack<T, Inline>::const_iterator
+ArrayStack<T, Inline>::begin() const {
+    return contents;
+}
+
+template <class T, std::size_t Inline>
+typename ArrayStack<T, Inline>::const_iterator
+ArrayStack<T, Inline>::cbegin() const {
+    return contents;
+}
+
+template <class T, std::size_t Inline>
+typename ArrayStack<T, Inline>::iterator
+ArrayStack<T, Inline>::end() {
+    return contents + _top + 1;
+}
+
+template <class T, std::size_t Inline>
+typename ArrayStack<T, Inline>::const_iterator
+ArrayStack<T, Inline>::end() const {
+    return contents + _top + 1;
+}
+
+template <class T, std::size_t Inline>
+typename ArrayStack<T, Inline>::const_iterator
+ArrayStack<T, Inline>::cend() const {
+    return contents + _top + 1;
+}
+
+template <class T, std::size_t Inline>
+T* ArrayStack<T, Inline>::initial_storage(std::size_t count) {
+    // O vetor de _max_size elementos fica para o spill() do primeiro push
+    // que passar de Inline elementos.
+    if (Inline > 0u && count <= Inline)
+        return this->inline_data();
+    return allocate(_max_size);
+}
+
+template <class T, std::size_t Inline>
+bool ArrayStack<T, Inline>::is_inline() const {
+    // Com Inline = 0, uma pilha sem vetor (movida) conta como inline.
+    return contents == this->inline_data();
+}
+
+template <class T, std::size_t Inline>
+void ArrayStack<T, Inline>::spill() {
+    auto data = allocate(_max_size);
+    try {
+        std::uninitialized_move(begin(), end(), data);
+    } catch (...) {
+        deallocate(data);
+        throw;
+    }
+    std::destroy(begin(), end());
+    contents = data;
+}
+
+template <class T, std::size_t Inline>
+void ArrayStack<T, Inline>::release() {
+    if (!is_inline())
+        deallocate(contents);
+}
+
+template <class T, std::size_t Inline>
+void ArrayStack<T, Inline>::take(ArrayStack& other) {
+    // Pre-condicao: esta pilha esta vazia e nao tem memoria no heap.
+    _max_size = other._max_size;
+    _top = -1;
+    if (other.is_inline()) {
+        contents = this->inline_data();
+        std::uninitialized_move(other.begin(), other.end(), contents);
+        _top = other._top;
+        other.clear();
+    } else {
+        contents = std::exchange(other.contents, other.inline_data());
+        _top = std::exchange(other._top, -1);
+    }
+}
+
+template <class T, std::size_t Inline>
+T* ArrayStack<T, Inline>::allocate(std::size_t count) {
+    return static_cast<T*>(::operator new(count * sizeof(T),
+                                          std::align_val_t{alignof(T)}));
+}
+
+template <class T, std::size_t Inline>
+void ArrayStack<T, Inline>::deallocate(T* data) {
+    ::operator delete(data, std::align_val_t{alignof(T)});
 }
 
 }  // namespace structures
@@ -0,0 +1,86 @@
+/* Copyright [2017] <Luiz Motta> */
+#include <string>
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "array_stack.h"
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+/**
+ * Teste unitario para pilha em vetor com espaco inline
+ */
+
+class ArrayStackTest: public ::testing::Test {
+protected:
+    /**
+     * Pilha na qual serao efetuadas as operações; as duas primeiras
+     * strings ficam inline.
+     */
+    structures::ArrayStack<std::string, 2u> stack{16u};
+};
+
+TEST_F(ArrayStackTest, PushAndPop) {
+    ASSERT_TRUE(stack.empty());
+    ASSERT_THROW(stack.pop(), std::out_of_range);
+    ASSERT_THROW(stack.top(), std::out_of_range);
+    for (auto i = 0u; i < 16u; ++i) {
+        stack.push(std::string(40, static_cast<char>('a' + i)));
+    }
+    ASSERT_TRUE(stack.full());
+    ASSERT_THROW(stack.push("x"), std::out_of_range);
+    for (auto i = 16u; i-- > 0u;) {
+        ASSERT_EQ(std::string(40, static_cast<char>('a' + i)), stack.pop());
+    }
+    ASSERT_TRUE(stack.empty());
+}
+
+/**
+ * O novo elemento eh construido antes de spill() mover os elementos
+ * inline, entao push(top()) na fronteira copia o topo certo.
+ */
+TEST_F(ArrayStackTest, PushTopAtInlineBoundary) {
+    stack.push(std::string(40, 'a'));
+    stack.push(std::string(40, 'b'));
+    stack.push(stack.top());
+    ASSERT_EQ(3u, stack.size());
+    ASSERT_EQ(std::string(40, 'b'), stack.pop());
+    ASSERT_EQ(std::string(40, 'b'), stack.pop());
+    ASSERT_EQ(std::string(40, 'a'), stack.pop());
+
+    structures::ArrayStack<std::string, 2u> moving{16u};
+    moving.push(std::string(40, 'a'));
+    moving.push(std::string(40, 'b'));
+    moving.emplace(std::move(moving.top()));
+    ASSERT_EQ(std::string(40, 'b'), moving.top());
+}
+
+TEST_F(ArrayStackTest, CopyAndMove) {
+    for (auto i = 0u; i < 5u; ++i) {
+        stack.push(std::string(40, static_cast<char>('a' + i)));
+    }
+    auto copy = stack;
+    ASSERT_EQ(5u, copy.size());
+    ASSERT_EQ(16u, copy.max_size());
+    ASSERT_EQ(stack.top(), copy.pop());
+
+    auto moved = std::move(stack);
+    ASSERT_TRUE(stack.empty());
+    ASSERT_EQ(16u, stack.max_size());
+    ASSERT_EQ(5u, moved.size());
+    // A pilha movida continua usavel, com o mesmo max_size.
+    for (auto i = 0u; i < 16u; ++i) {
+        stack.push(moved.top());
+    }
+    ASSERT_TRUE(stack.full());
+
+    moved = copy;
+    ASSERT_EQ(4u, moved.size());
+    copy.clear();
+    copy.push("x");
+    copy.swap(moved);
+    ASSERT_EQ(4u, copy.size());
+    ASSERT_EQ("x", moved.top());
+}
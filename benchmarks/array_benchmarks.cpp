@@ -0,0 +1,43 @@
+// Copyright [2017] <Luiz Motta>
+#include "benchmarks.h"
+
+/**
+ * Benchmarks dos containers baseados em vetor.
+ */
+
+STRUCTURES_BENCHMARK_LIST(structures::ArrayList, 10000000);
+
+STRUCTURES_BENCHMARK(BM_InsertSorted, structures::SortedArrayList, int,
+                     10000000);
+STRUCTURES_BENCHMARK(BM_InsertSorted, structures::SortedArrayList,
+                     std::string, 10000000);
+STRUCTURES_BENCHMARK(BM_Find, structures::SortedArrayList, int, 10000000);
+STRUCTURES_BENCHMARK(BM_Find, structures::SortedArrayList, std::string,
+                     10000000);
+
+STRUCTURES_BENCHMARK_PUSH_POP(structures::ArrayStack, 10000000);
+
+STRUCTURES_BENCHMARK_PUSH_POP(structures::ArrayQueue, 10000000);
+
+/*!
+ * \brief Cria, usa e destroi uma pilha pequena, como o avaliador de
+ * expressoes faz a cada expressao; o argumento eh o max_size, que pode
+ * ser bem maior que os 8 elementos usados.
+ */
+template<typename Stack>
+static void BM_SmallStack(benchmark::State& state) {
+    for (auto _ : state) {
+        Stack stack(static_cast<std::size_t>(state.range(0)));
+        for (auto i = 0; i < 8; ++i) {
+            stack.push(i);
+        }
+        while (!stack.empty()) {
+            benchmark::DoNotOptimize(stack.pop());
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_SmallStack, structures::ArrayStack<int>)
+    ->Arg(16)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_SmallStack, structures::ArrayStack<int, 16u>)
+    ->Arg(16)->Arg(1024);
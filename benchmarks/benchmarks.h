@@ -0,0 +1,394 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_BENCHMARKS_H
+#define STRUCTURES_BENCHMARKS_H
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "../array_list/array_list.h"
+#include "../array_queue/array_queue.h"
+#include "../array_stack/array_stack.h"
+#include "../circular_list/circular_list.h"
+#include "../doubly_cicular_list/doubly_circular_list.h"
+#include "../doubly_linked_list/doubly_linked_list.h"
+#include "../linked_list/linked_list.h"
+#include "../linked_queue/linked_queue.h"
+#include "../linked_stack/linked_stack.h"
+#include "../skip_list/skip_list.h"
+#include "../sorted_array_list/sorted_array_list.h"
+#include "../unrolled_linked_list/unrolled_linked_list.h"
+
+namespace bench {
+
+/*!
+ * \brief Elemento POD de 64 bytes, ordenado pelo primeiro campo.
+ */
+struct Pod64 {
+    std::int64_t values[8];
+
+    bool operator==(const Pod64& other) const {
+        return values[0] == other.values[0];
+    }
+    bool operator!=(const Pod64& other) const { return !(*this == other); }
+    bool operator<(const Pod64& other) const {
+        return values[0] < other.values[0];
+    }
+    bool operator>(const Pod64& other) const { return other < *this; }
+    bool operator<=(const Pod64& other) const { return !(other < *this); }
+};
+
+static_assert(sizeof(Pod64) == 64, "Pod64 deve ter 64 bytes");
+
+/*!
+ * \brief Gera o i-esimo elemento de uma sequencia crescente.
+ */
+template<typename T>
+T make(std::size_t i);
+
+template<>
+inline int make<int>(std::size_t i) { return static_cast<int>(i); }
+
+template<>
+inline Pod64 make<Pod64>(std::size_t i) {
+    Pod64 pod{};
+    for (auto& value : pod.values) {
+        value = static_cast<std::int64_t>(i);
+    }
+    return pod;
+}
+
+template<>
+inline std::string make<std::string>(std::size_t i) {
+    // 20 digitos: maior que o buffer de SSO, forca alocacao no heap.
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%020zu", i);
+    return buffer;
+}
+
+/*!
+ * \brief Cria um container vazio com capacidade para n elementos.
+ */
+template<typename C>
+struct Factory {
+    static std::unique_ptr<C> create(std::size_t) {
+        return std::unique_ptr<C>(new C());
+    }
+};
+
+template<typename T>
+struct Factory<structures::ArrayList<T>> {
+    static std::unique_ptr<structures::ArrayList<T>> create(std::size_t n) {
+        return std::unique_ptr<structures::ArrayList<T>>(
+            new structures::ArrayList<T>(n + 1, 2.0));
+    }
+};
+
+template<typename T>
+struct Factory<structures::SortedArrayList<T>> {
+    static std::unique_ptr<structures::SortedArrayList<T>> create(
+        std::size_t n) {
+        return std::unique_ptr<structures::SortedArrayList<T>>(
+            new structures::SortedArrayList<T>(n + 1));
+    }
+};
+
+template<typename T>
+struct Factory<structures::ArrayStack<T>> {
+    static std::unique_ptr<structures::ArrayStack<T>> create(std::size_t n) {
+        return std::unique_ptr<structures::ArrayStack<T>>(
+            new structures::ArrayStack<T>(n));
+    }
+};
+
+template<typename T, bool P>
+struct Factory<structures::ArrayQueue<T, P>> {
+    static std::unique_ptr<structures::ArrayQueue<T, P>> create(
+        std::size_t n) {
+        return std::unique_ptr<structures::ArrayQueue<T, P>>(
+            new structures::ArrayQueue<T, P>(n));
+    }
+};
+
+/*
+ * push/pop usam a extremidade barata de cada container: o final dos
+ * vetores e das filas, o topo das pilhas e o inicio das listas.
+ */
+template<typename T>
+void push(structures::ArrayList<T>& c, const T& d) { c.push_back(d); }
+template<typename T>
+T pop(structures::ArrayList<T>& c) { return c.pop_back(); }
+
+template<typename T>
+void push(structures::ArrayStack<T>& c, const T& d) { c.push(d); }
+template<typename T>
+T pop(structures::ArrayStack<T>& c) { return c.pop(); }
+
+template<typename T, bool P>
+void push(structures::ArrayQueue<T, P>& c, const T& d) { c.enqueue(d); }
+template<typename T, bool P>
+T pop(structures::ArrayQueue<T, P>& c) { return c.dequeue(); }
+
+template<typename T, typename A>
+void push(structures::LinkedStack<T, A>& c, const T& d) { c.push(d); }
+template<typename T, typename A>
+T pop(structures::LinkedStack<T, A>& c) { return c.pop(); }
+
+template<typename T, typename A>
+void push(structures::LinkedQueue<T, A>& c, const T& d) { c.enqueue(d); }
+template<typename T, typename A>
+T pop(structures::LinkedQueue<T, A>& c) { return c.dequeue(); }
+
+template<typename T, typename A>
+void push(structures::LinkedList<T, A>& c, const T& d) { c.push_front(d); }
+template<typename T, typename A>
+T pop(structures::LinkedList<T, A>& c) { return c.pop_front(); }
+
+template<typename T, typename A>
+void push(structures::CircularList<T, A>& c, const T& d) { c.push_front(d); }
+template<typename T, typename A>
+T pop(structures::CircularList<T, A>& c) { return c.pop_front(); }
+
+template<typename T, typename A>
+void push(structures::DoublyLinkedList<T, A>& c, const T& d) {
+    c.push_front(d);
+}
+template<typename T, typename A>
+T pop(structures::DoublyLinkedList<T, A>& c) { return c.pop_front(); }
+
+template<typename T, typename A>
+void push(structures::DoublyCircularList<T, A>& c, const T& d) {
+    c.push_front(d);
+}
+template<typename T, typename A>
+T pop(structures::DoublyCircularList<T, A>& c) { return c.pop_front(); }
+
+template<typename T, typename A, std::size_t N>
+void push(structures::UnrolledLinkedList<T, A, N>& c, const T& d) {
+    c.push_front(d);
+}
+template<typename T, typename A, std::size_t N>
+T pop(structures::UnrolledLinkedList<T, A, N>& c) { return c.pop_front(); }
+
+template<typename T>
+void push(structures::SkipList<T>& c, const T& d) { c.insert_sorted(d); }
+template<typename T>
+T pop(structures::SkipList<T>& c) { return c.pop_front(); }
+
+/*!
+ * \brief Preenche a lista com make(0), make(2), ..., make(2n-2) em ordem.
+ */
+template<typename C, typename T>
+struct Filler {
+    static void fill_sorted(C& c, std::size_t n) {
+        for (auto i = n; i > 0; --i) {
+            c.push_front(make<T>(2 * (i - 1)));
+        }
+    }
+};
+
+template<typename T>
+struct Filler<structures::ArrayList<T>, T> {
+    static void fill_sorted(structures::ArrayList<T>& c, std::size_t n) {
+        for (auto i = 0u; i < n; ++i) {
+            c.push_back(make<T>(2 * i));
+        }
+    }
+};
+
+template<typename T>
+struct Filler<structures::SortedArrayList<T>, T> {
+    static void fill_sorted(structures::SortedArrayList<T>& c,
+                            std::size_t n) {
+        for (auto i = 0u; i < n; ++i) {
+            c.insert_sorted(make<T>(2 * i));
+        }
+    }
+};
+
+template<typename T>
+struct Filler<structures::SkipList<T>, T> {
+    static void fill_sorted(structures::SkipList<T>& c, std::size_t n) {
+        for (auto i = 0u; i < n; ++i) {
+            c.insert_sorted(make<T>(2 * i));
+        }
+    }
+};
+
+}  // namespace bench
+
+/*!
+ * \brief Tempo para inserir n elementos num container vazio.
+ */
+template<typename C, typename T>
+void BM_Push(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    T samples[64];
+    for (auto i = 0u; i < 64u; ++i) {
+        samples[i] = bench::make<T>(i);
+    }
+    for (auto _ : state) {
+        auto c = bench::Factory<C>::create(n);
+        for (auto i = 0u; i < n; ++i) {
+            bench::push(*c, samples[i & 63u]);
+        }
+        state.PauseTiming();
+        c.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+/*!
+ * \brief Tempo para retirar n elementos de um container cheio.
+ */
+template<typename C, typename T>
+void BM_Pop(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto sample = bench::make<T>(n);
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto c = bench::Factory<C>::create(n);
+        for (auto i = 0u; i < n; ++i) {
+            bench::push(*c, sample);
+        }
+        state.ResumeTiming();
+        for (auto i = 0u; i < n; ++i) {
+            benchmark::DoNotOptimize(bench::pop(*c));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+/*!
+ * \brief insert no meio seguido de pop da mesma posicao.
+ */
+template<typename C, typename T>
+void BM_Insert(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto c = bench::Factory<C>::create(n);
+    bench::Filler<C, T>::fill_sorted(*c, n);
+    auto value = bench::make<T>(n);
+    for (auto _ : state) {
+        c->insert(value, n / 2);
+        benchmark::DoNotOptimize(c->pop(n / 2));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/*!
+ * \brief insert_sorted de um elemento do meio seguido de pop dele.
+ */
+template<typename C, typename T>
+void BM_InsertSorted(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto c = bench::Factory<C>::create(n);
+    bench::Filler<C, T>::fill_sorted(*c, n);
+    auto middle = n / 2;
+    auto value = bench::make<T>(2 * middle + 1);
+    for (auto _ : state) {
+        c->insert_sorted(value);
+        benchmark::DoNotOptimize(c->pop(middle + 1));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/*!
+ * \brief find de um elemento no meio do container.
+ */
+template<typename C, typename T>
+void BM_Find(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto c = bench::Factory<C>::create(n);
+    bench::Filler<C, T>::fill_sorted(*c, n);
+    auto value = bench::make<T>(2 * (n / 2));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c->find(value));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/*!
+ * \brief Percorre o container inteiro com iteradores.
+ */
+template<typename C, typename T>
+void BM_Iterate(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto c = bench::Factory<C>::create(n);
+    bench::Filler<C, T>::fill_sorted(*c, n);
+    for (auto _ : state) {
+        for (auto& data : *c) {
+            benchmark::DoNotOptimize(&data);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+/*!
+ * \brief at no meio do container.
+ */
+template<typename C, typename T>
+void BM_At(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto c = bench::Factory<C>::create(n);
+    bench::Filler<C, T>::fill_sorted(*c, n);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c->at(n / 2));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/*!
+ * \brief remove de um elemento do meio seguido de sua reinsercao.
+ */
+template<typename C, typename T>
+void BM_Remove(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    auto c = bench::Factory<C>::create(n);
+    bench::Filler<C, T>::fill_sorted(*c, n);
+    auto middle = n / 2;
+    auto value = bench::make<T>(2 * middle);
+    for (auto _ : state) {
+        c->remove(value);
+        c->insert(value, middle);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+#define STRUCTURES_BENCHMARK(bm, C, T, max) \
+    BENCHMARK_TEMPLATE(bm, C<T>, T)->RangeMultiplier(10)->Range(1000, max)
+
+/*!
+ * \brief Registra push/pop de uma pilha ou fila para int, Pod64 e string.
+ */
+#define STRUCTURES_BENCHMARK_PUSH_POP(C, max) \
+    STRUCTURES_BENCHMARK(BM_Push, C, int, max); \
+    STRUCTURES_BENCHMARK(BM_Push, C, bench::Pod64, max); \
+    STRUCTURES_BENCHMARK(BM_Push, C, std::string, max); \
+    STRUCTURES_BENCHMARK(BM_Pop, C, int, max); \
+    STRUCTURES_BENCHMARK(BM_Pop, C, bench::Pod64, max); \
+    STRUCTURES_BENCHMARK(BM_Pop, C, std::string, max)
+
+#define STRUCTURES_BENCHMARK_LIST_OPS(C, T, max) \
+    STRUCTURES_BENCHMARK(BM_Insert, C, T, max); \
+    STRUCTURES_BENCHMARK(BM_InsertSorted, C, T, max); \
+    STRUCTURES_BENCHMARK(BM_Find, C, T, max); \
+    STRUCTURES_BENCHMARK(BM_Iterate, C, T, max); \
+    STRUCTURES_BENCHMARK(BM_At, C, T, max); \
+    STRUCTURES_BENCHMARK(BM_Remove, C, T, max)
+
+/*!
+ * \brief Registra todas as operacoes de uma lista para int, Pod64 e string.
+ */
+#define STRUCTURES_BENCHMARK_LIST(C, max) \
+    STRUCTURES_BENCHMARK_PUSH_POP(C, max); \
+    STRUCTURES_BENCHMARK_LIST_OPS(C, int, max); \
+    STRUCTURES_BENCHMARK_LIST_OPS(C, bench::Pod64, max); \
+    STRUCTURES_BENCHMARK_LIST_OPS(C, std::string, max)
+
+#endif
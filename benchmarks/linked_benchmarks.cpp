@@ -0,0 +1,32 @@
+// Copyright [2017] <Luiz Motta>
+#include "benchmarks.h"
+
+/**
+ * Benchmarks dos containers encadeados.
+ */
+
+STRUCTURES_BENCHMARK_LIST(structures::LinkedList, 10000000);
+
+STRUCTURES_BENCHMARK_LIST(structures::UnrolledLinkedList, 10000000);
+
+// SkipList nao tem insert(data, index) nem remove seguido de insert.
+STRUCTURES_BENCHMARK_PUSH_POP(structures::SkipList, 10000000);
+STRUCTURES_BENCHMARK(BM_InsertSorted, structures::SkipList, int, 10000000);
+STRUCTURES_BENCHMARK(BM_Find, structures::SkipList, int, 10000000);
+STRUCTURES_BENCHMARK(BM_Iterate, structures::SkipList, int, 10000000);
+STRUCTURES_BENCHMARK(BM_At, structures::SkipList, int, 10000000);
+STRUCTURES_BENCHMARK(BM_InsertSorted, structures::SkipList, std::string,
+                     10000000);
+STRUCTURES_BENCHMARK(BM_Find, structures::SkipList, std::string, 10000000);
+
+STRUCTURES_BENCHMARK_LIST(structures::DoublyLinkedList, 10000000);
+
+STRUCTURES_BENCHMARK_LIST(structures::DoublyCircularList, 10000000);
+
+// push_front da CircularList percorre o anel ate o ultimo Node, entao
+// preencher a lista eh O(n^2).
+STRUCTURES_BENCHMARK_LIST(structures::CircularList, 10000);
+
+STRUCTURES_BENCHMARK_PUSH_POP(structures::LinkedStack, 10000000);
+
+STRUCTURES_BENCHMARK_PUSH_POP(structures::LinkedQueue, 10000000);
@@ -0,0 +1,12 @@
+// Copyright [2017] <Luiz Motta>
+#include <benchmark/benchmark.h>
+
+/**
+ * Suite de benchmarks dos containers.
+ *
+ * Para gerar resultados comparaveis entre versoes:
+ *     ./structures_benchmarks --benchmark_out=results.json \
+ *         --benchmark_out_format=json
+ * e compare os JSON com tools/compare.py do Google Benchmark.
+ */
+BENCHMARK_MAIN();
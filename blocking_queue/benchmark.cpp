@@ -0,0 +1,133 @@
+// Copyright [2017] <Luiz Motta>
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "../linked_queue/linked_queue.h"
+#include "blocking_queue.h"
+
+/**
+ * Um produtor envia itens para 1 a N consumidores: LinkedQueue com mutex
+ * e variavel de condicao que notifica a cada enqueue e entrega um item por
+ * vez, contra BlockingQueue com dequeue_batch. "locks" conta quantas
+ * vezes os consumidores pegaram o lock por item entregue; na NaiveQueue
+ * "wakeups" conta quantas vezes eles voltaram de wait, e na BlockingQueue
+ * cada lock espera no maximo uma vez.
+ */
+
+namespace {
+
+constexpr std::int64_t ITEMS = 1 << 16;
+constexpr std::size_t BATCH = 64u;
+
+int max_consumers() {
+    auto n = static_cast<int>(std::thread::hardware_concurrency());
+    return n < 2 ? 1 : n - 1;
+}
+
+std::atomic<std::int64_t> wakeups{0};
+std::atomic<std::int64_t> locks{0};
+
+/*!
+ * \brief LinkedQueue protegida do jeito ingenuo.
+ */
+class NaiveQueue {
+ public:
+    void enqueue(int data) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.enqueue(data);
+        }
+        not_empty_.notify_one();
+    }
+
+    bool dequeue(int& data) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        locks.fetch_add(1, std::memory_order_relaxed);
+        while (queue_.empty() && !closed_) {
+            not_empty_.wait(lock);
+            wakeups.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (queue_.empty())
+            return false;
+        data = queue_.dequeue();
+        return true;
+    }
+
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        not_empty_.notify_all();
+    }
+
+ private:
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    structures::LinkedQueue<int> queue_;
+    bool closed_{false};
+};
+
+void consume(NaiveQueue& queue) {
+    int data;
+    while (queue.dequeue(data))
+        benchmark::DoNotOptimize(data);
+}
+
+void consume(structures::BlockingQueue<int>& queue) {
+    int batch[BATCH];
+    while (!queue.closed() || !queue.empty()) {
+        // Cada chamada pega o lock uma vez e espera no maximo uma vez.
+        auto count = queue.dequeue_batch(batch, BATCH,
+                                         std::chrono::milliseconds(10));
+        locks.fetch_add(1, std::memory_order_relaxed);
+        benchmark::DoNotOptimize(batch[0]);
+        benchmark::DoNotOptimize(count);
+    }
+}
+
+}  // namespace
+
+template<typename Queue>
+static void BM_ProducerConsumers(benchmark::State& state) {
+    wakeups = 0;
+    locks = 0;
+    std::int64_t items = 0;
+    for (auto _ : state) {
+        Queue queue;
+        std::vector<std::thread> consumers;
+        for (auto c = 0; c < state.range(0); ++c) {
+            consumers.emplace_back([&queue] { consume(queue); });
+        }
+        for (auto i = 0; i < ITEMS; ++i) {
+            queue.enqueue(i);
+        }
+        queue.close();
+        for (auto& consumer : consumers) {
+            consumer.join();
+        }
+        items += ITEMS;
+    }
+    state.SetItemsProcessed(items);
+    if constexpr (std::is_same_v<Queue, NaiveQueue>) {
+        state.counters["wakeups"] = benchmark::Counter(
+            static_cast<double>(wakeups.load()) / static_cast<double>(items));
+    }
+    state.counters["locks"] = benchmark::Counter(
+        static_cast<double>(locks.load()) / static_cast<double>(items));
+}
+
+BENCHMARK_TEMPLATE(BM_ProducerConsumers, NaiveQueue)
+    ->DenseRange(1, max_consumers())->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ProducerConsumers, structures::BlockingQueue<int>)
+    ->DenseRange(1, max_consumers())->UseRealTime();
+
+BENCHMARK_MAIN();
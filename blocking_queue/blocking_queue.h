@@ -0,0 +1,374 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_BLOCKING_QUEUE_H
+#define STRUCTURES_BLOCKING_QUEUE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "../linked_queue/linked_queue.h"
+
+namespace structures {
+
+/*!
+ * \brief Verifica se a fila tem full(), como a ArrayQueue; nesse caso a
+ * BlockingQueue espera por espaco em enqueue.
+ */
+template<typename Queue, typename = void>
+struct is_bounded_queue : std::false_type {};
+
+template<typename Queue>
+struct is_bounded_queue<Queue, std::void_t<decltype(
+    std::declval<Queue&>().full())>> : std::true_type {};
+
+/*!
+ * \brief BlockingQueue adapta uma fila (LinkedQueue ou ArrayQueue) para
+ * produtores e consumidores em threads diferentes, com um mutex e
+ * variaveis de condicao.
+ *
+ * Para acordar menos: um produtor so notifica quando a fila estava vazia
+ * e ha consumidor esperando, e o consumidor acordado repassa a vez para
+ * outro se deixar elementos na fila. Do mesmo jeito, retirar um elemento
+ * de uma fila cheia acorda um unico produtor, que repassa a vez se ainda
+ * houver espaco; so dequeue_batch, que pode liberar varias posicoes,
+ * acorda todos. dequeue_batch tira ate max elementos com uma unica
+ * aquisicao do lock, entao um consumidor lento acorda uma vez por lote em
+ * vez de uma vez por elemento.
+ *
+ * on_high_watermark registra uma funcao chamada pelo enqueue que faz a
+ * fila chegar a um tamanho, para o produtor desacelerar; ela eh chamada
+ * de novo so depois que a fila voltar para baixo da marca. A funcao roda
+ * fora do lock e pode usar a fila.
+ *
+ * close() recusa novos elementos e deixa os consumidores esvaziarem a
+ * fila; shutdown() tambem descarta o que restou. Em ambos os casos as
+ * threads bloqueadas acordam.
+ */
+template<typename T, typename Queue = LinkedQueue<T>>
+class BlockingQueue {
+ public:
+    using value_type = T;
+    using Callback = std::function<void(std::size_t)>;
+
+    /*!
+     * \brief Construtor; os argumentos sao repassados para a fila
+     * (por exemplo a capacidade de uma ArrayQueue)
+     */
+    template<typename... Args>
+    explicit BlockingQueue(Args&&... args);
+
+    BlockingQueue(const BlockingQueue&) = delete;
+
+    BlockingQueue& operator=(const BlockingQueue&) = delete;
+
+    /*!
+     * \brief Coloca um elemento no final da fila, esperando por espaco se
+     * a fila for limitada
+     *
+     * \param data, dado a ser armazenado
+     *
+     * \return false se a fila foi fechada
+     */
+    bool enqueue(const T& data);
+
+    /*!
+     * \brief Coloca um elemento no final da fila, movendo o dado
+     *
+     * \param data, dado a ser armazenado
+     *
+     * \return false se a fila foi fechada (data nao eh movido)
+     */
+    bool enqueue(T&& data);
+
+    /*!
+     * \brief Retira o elemento do inicio da fila, esperando se ela estiver
+     * vazia
+     *
+     * \return o dado retirado, ou std::nullopt se a fila foi fechada e
+     * esvaziada
+     */
+    std::optional<T> dequeue();
+
+    /*!
+     * \brief Retira o elemento do inicio da fila sem esperar
+     *
+     * \return o dado retirado, ou std::nullopt se a fila estiver vazia
+     */
+    std::optional<T> try_dequeue();
+
+    /*!
+     * \brief Espera ate timeout por pelo menos um elemento e retira ate
+     * max elementos com uma unica aquisicao do lock
+     *
+     * \param out, iterador de saida que recebe os elementos em ordem
+     * \param max, quantidade maxima de elementos
+     * \param timeout, tempo maximo de espera pelo primeiro elemento
+     *
+     * \return quantidade de elementos retirados; 0 se max eh 0 (sem
+     * esperar), se o tempo acabou ou se a fila foi fechada e esvaziada
+     */
+    template<typename OutputIt, typename Rep, typename Period>
+    std::size_t dequeue_batch(OutputIt out, std::size_t max,
+                              std::chrono::duration<Rep, Period> timeout);
+
+    /*!
+     * \brief Registra a funcao chamada quando um enqueue faz a fila chegar
+     * a watermark elementos
+     *
+     * \param watermark, tamanho que dispara a funcao
+     * \param callback, recebe o tamanho da fila
+     */
+    void on_high_watermark(std::size_t watermark, Callback callback);
+
+    /*!
+     * \brief Fecha a fila: enqueue passa a falhar e os consumidores
+     * recebem os elementos restantes
+     */
+    void close();
+
+    /*!
+     * \brief Fecha a fila e descarta os elementos restantes
+     */
+    void shutdown();
+
+    /*!
+     * \brief Verifica se a fila foi fechada
+     *
+     * \return true depois de close() ou shutdown()
+     */
+    bool closed() const;
+
+    /*!
+     * \brief Verifica se a fila esta vazia
+     *
+     * \return true caso a fila esteja vazia no momento da chamada
+     */
+    bool empty() const;
+
+    /*!
+     * \brief Passa o tamanho da fila
+     *
+     * \return tamanho da fila no momento da chamada
+     */
+    std::size_t size() const;
+
+ private:
+    bool full();
+
+    T take();
+
+    void rearm_watermark();
+
+    void notify_consumers(bool was_empty);
+
+    void notify_producers(bool was_full, std::size_t freed);
+
+    mutable std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    Queue queue_;
+    std::size_t size_{0u};
+    std::size_t consumers_waiting_{0u};
+    std::size_t producers_waiting_{0u};
+    std::size_t watermark_{0u};
+    bool watermark_armed_{false};
+    bool closed_{false};
+    Callback callback_;
+};
+
+    template<typename T, typename Queue>
+    template<typename... Args>
+    BlockingQueue<T, Queue>::BlockingQueue(Args&&... args) :
+        queue_(std::forward<Args>(args)...)
+    {}
+
+    template<typename T, typename Queue>
+    bool BlockingQueue<T, Queue>::enqueue(const T& data) {
+        T copy{data};
+        return enqueue(std::move(copy));
+    }
+
+    template<typename T, typename Queue>
+    bool BlockingQueue<T, Queue>::enqueue(T&& data) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (full()) {
+            ++producers_waiting_;
+            not_full_.wait(lock, [this] { return closed_ || !full(); });
+            --producers_waiting_;
+        }
+        if (closed_)
+            return false;
+        queue_.enqueue(std::move(data));
+        auto was_empty = size_++ == 0u;
+        if (producers_waiting_ > 0u && !full())
+            not_full_.notify_one();
+        Callback callback;
+        if (watermark_armed_ && size_ >= watermark_) {
+            // Copia para chamar fora do lock sem disputar com
+            // on_high_watermark.
+            watermark_armed_ = false;
+            callback = callback_;
+        }
+        auto size = size_;
+        notify_consumers(was_empty);
+        lock.unlock();
+        if (callback)
+            callback(size);
+        return true;
+    }
+
+    template<typename T, typename Queue>
+    std::optional<T> BlockingQueue<T, Queue>::dequeue() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (size_ == 0u) {
+            ++consumers_waiting_;
+            not_empty_.wait(lock, [this] { return closed_ || size_ > 0u; });
+            --consumers_waiting_;
+        }
+        if (size_ == 0u)
+            return std::nullopt;
+        return take();
+    }
+
+    template<typename T, typename Queue>
+    std::optional<T> BlockingQueue<T, Queue>::try_dequeue() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (size_ == 0u)
+            return std::nullopt;
+        return take();
+    }
+
+    template<typename T, typename Queue>
+    template<typename OutputIt, typename Rep, typename Period>
+    std::size_t BlockingQueue<T, Queue>::dequeue_batch(
+        OutputIt out, std::size_t max,
+        std::chrono::duration<Rep, Period> timeout) {
+        // Sem esperar: um lote vazio consumiria o notify_one de um enqueue.
+        if (max == 0u)
+            return 0u;
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (size_ == 0u) {
+            ++consumers_waiting_;
+            not_empty_.wait_for(lock, timeout,
+                                [this] { return closed_ || size_ > 0u; });
+            --consumers_waiting_;
+        }
+        auto was_full = full();
+        std::size_t count = 0u;
+        while (count < max && size_ > 0u) {
+            *out = queue_.dequeue();
+            ++out;
+            --size_;
+            ++count;
+        }
+        rearm_watermark();
+        if (count > 0u) {
+            if (size_ > 0u && consumers_waiting_ > 0u)
+                not_empty_.notify_one();
+            notify_producers(was_full, count);
+        }
+        return count;
+    }
+
+    template<typename T, typename Queue>
+    void BlockingQueue<T, Queue>::on_high_watermark(std::size_t watermark,
+                                                    Callback callback) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        watermark_ = watermark;
+        callback_ = std::move(callback);
+        watermark_armed_ = static_cast<bool>(callback_) && size_ < watermark;
+    }
+
+    template<typename T, typename Queue>
+    void BlockingQueue<T, Queue>::close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        not_empty_.notify_all();
+        not_full_.notify_all();
+    }
+
+    template<typename T, typename Queue>
+    void BlockingQueue<T, Queue>::shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+            while (size_ > 0u) {
+                queue_.dequeue();
+                --size_;
+            }
+        }
+        not_empty_.notify_all();
+        not_full_.notify_all();
+    }
+
+    template<typename T, typename Queue>
+    bool BlockingQueue<T, Queue>::closed() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return closed_;
+    }
+
+    template<typename T, typename Queue>
+    bool BlockingQueue<T, Queue>::empty() const {
+        return size() == 0u;
+    }
+
+    template<typename T, typename Queue>
+    std::size_t BlockingQueue<T, Queue>::size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return size_;
+    }
+
+    template<typename T, typename Queue>
+    bool BlockingQueue<T, Queue>::full() {
+        if constexpr (is_bounded_queue<Queue>::value)
+            return queue_.full();
+        else
+            return false;
+    }
+
+    template<typename T, typename Queue>
+    T BlockingQueue<T, Queue>::take() {
+        auto was_full = full();
+        auto data = queue_.dequeue();
+        --size_;
+        rearm_watermark();
+        if (size_ > 0u && consumers_waiting_ > 0u)
+            not_empty_.notify_one();
+        notify_producers(was_full, 1u);
+        return data;
+    }
+
+    template<typename T, typename Queue>
+    void BlockingQueue<T, Queue>::rearm_watermark() {
+        if (callback_ && size_ < watermark_)
+            watermark_armed_ = true;
+    }
+
+    template<typename T, typename Queue>
+    void BlockingQueue<T, Queue>::notify_consumers(bool was_empty) {
+        if (was_empty && consumers_waiting_ > 0u)
+            not_empty_.notify_one();
+    }
+
+    template<typename T, typename Queue>
+    void BlockingQueue<T, Queue>::notify_producers(bool was_full,
+                                                   std::size_t freed) {
+        if (!was_full || producers_waiting_ == 0u)
+            return;
+        if (freed > 1u)
+            not_full_.notify_all();
+        else
+            not_full_.notify_one();
+    }
+
+}  // namespace structures
+
+#endif
@@ -0,0 +1,268 @@
+/* Copyright [2017] <Luiz Motta> */
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "../array_queue/array_queue.h"
+#include "blocking_queue.h"
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+/**
+ * Teste unitario para fila bloqueante
+ */
+
+class BlockingQueueTest: public ::testing::Test {
+protected:
+    /**
+     * Fila na qual serao efetuadas as operações
+     */
+    structures::BlockingQueue<int> queue;
+};
+
+TEST_F(BlockingQueueTest, EnqueueAndDequeue) {
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.try_dequeue());
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_TRUE(queue.enqueue(i));
+    }
+    ASSERT_EQ(10u, queue.size());
+    for (auto i = 0; i < 5; ++i) {
+        ASSERT_EQ(i, queue.dequeue());
+    }
+    for (auto i = 5; i < 10; ++i) {
+        ASSERT_EQ(i, queue.try_dequeue());
+    }
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(BlockingQueueTest, DequeueBatch) {
+    std::vector<int> out;
+    auto timeout = std::chrono::milliseconds(1);
+    ASSERT_EQ(0u, queue.dequeue_batch(std::back_inserter(out), 4u, timeout));
+    // max == 0 retorna logo, mesmo com a fila vazia e um timeout longo.
+    ASSERT_EQ(0u, queue.dequeue_batch(std::back_inserter(out), 0u,
+                                      std::chrono::hours(1)));
+    for (auto i = 0; i < 10; ++i) {
+        queue.enqueue(i);
+    }
+    ASSERT_EQ(0u, queue.dequeue_batch(std::back_inserter(out), 0u, timeout));
+    ASSERT_EQ(10u, queue.size());
+    ASSERT_EQ(4u, queue.dequeue_batch(std::back_inserter(out), 4u, timeout));
+    ASSERT_EQ(6u, queue.dequeue_batch(std::back_inserter(out), 16u, timeout));
+    ASSERT_EQ(10u, out.size());
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(i, out[i]);
+    }
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(BlockingQueueTest, DequeueBatchWaits) {
+    std::thread producer([this] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.enqueue(7);
+    });
+    int out[4];
+    auto count = queue.dequeue_batch(out, 4u, std::chrono::seconds(10));
+    producer.join();
+    ASSERT_EQ(1u, count);
+    ASSERT_EQ(7, out[0]);
+}
+
+TEST_F(BlockingQueueTest, HighWatermark) {
+    std::vector<std::size_t> calls;
+    queue.on_high_watermark(3u, [&](std::size_t size) {
+        calls.push_back(size);
+    });
+    for (auto i = 0; i < 5; ++i) {
+        queue.enqueue(i);
+    }
+    // Dispara uma vez ao cruzar a marca, nao a cada enqueue acima dela.
+    ASSERT_EQ(std::vector<std::size_t>{3u}, calls);
+    queue.dequeue();
+    queue.dequeue();
+    queue.enqueue(5);
+    ASSERT_EQ(1u, calls.size());
+    // Abaixo da marca a funcao eh rearmada.
+    queue.dequeue();
+    queue.dequeue();
+    queue.enqueue(6);
+    ASSERT_EQ((std::vector<std::size_t>{3u, 3u}), calls);
+}
+
+TEST_F(BlockingQueueTest, WatermarkCallbackCanUseQueue) {
+    queue.on_high_watermark(2u, [this](std::size_t) {
+        queue.try_dequeue();
+    });
+    queue.enqueue(1);
+    queue.enqueue(2);
+    ASSERT_EQ(1u, queue.size());
+    ASSERT_EQ(2, queue.dequeue());
+}
+
+TEST_F(BlockingQueueTest, Close) {
+    queue.enqueue(1);
+    queue.enqueue(2);
+    queue.close();
+    ASSERT_TRUE(queue.closed());
+    ASSERT_FALSE(queue.enqueue(3));
+    ASSERT_EQ(1, queue.dequeue());
+    int out[4];
+    ASSERT_EQ(1u, queue.dequeue_batch(out, 4u, std::chrono::seconds(10)));
+    ASSERT_EQ(2, out[0]);
+    // Fechada e vazia: nao espera.
+    ASSERT_FALSE(queue.dequeue());
+    ASSERT_EQ(0u, queue.dequeue_batch(out, 4u, std::chrono::seconds(10)));
+}
+
+TEST_F(BlockingQueueTest, CloseWakesConsumers) {
+    std::vector<std::thread> consumers;
+    std::atomic<int> finished{0};
+    for (auto i = 0; i < 3; ++i) {
+        consumers.emplace_back([&] {
+            if (!queue.dequeue())
+                finished.fetch_add(1);
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.close();
+    for (auto& consumer : consumers) {
+        consumer.join();
+    }
+    ASSERT_EQ(3, finished.load());
+}
+
+TEST_F(BlockingQueueTest, Shutdown) {
+    structures::BlockingQueue<std::string> strings;
+    strings.enqueue(std::string(64, 'a'));
+    strings.enqueue(std::string(64, 'b'));
+    strings.shutdown();
+    ASSERT_TRUE(strings.closed());
+    ASSERT_TRUE(strings.empty());
+    ASSERT_FALSE(strings.dequeue());
+    ASSERT_FALSE(strings.enqueue(std::string(64, 'c')));
+}
+
+TEST_F(BlockingQueueTest, BoundedBackpressure) {
+    structures::BlockingQueue<int, structures::ArrayQueue<int>> bounded{4u};
+    std::atomic<int> sent{0};
+    std::thread producer([&] {
+        for (auto i = 0; i < 10; ++i) {
+            bounded.enqueue(i);
+            sent.fetch_add(1);
+        }
+    });
+    // O produtor para quando a fila enche.
+    while (bounded.size() < 4u)
+        std::this_thread::yield();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_EQ(4, sent.load());
+
+    std::vector<int> out;
+    while (out.size() < 10u) {
+        bounded.dequeue_batch(std::back_inserter(out), 3u,
+                              std::chrono::seconds(10));
+    }
+    producer.join();
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(i, out[i]);
+    }
+}
+
+TEST_F(BlockingQueueTest, CloseWakesProducers) {
+    structures::BlockingQueue<int, structures::ArrayQueue<int>> bounded{1u};
+    bounded.enqueue(0);
+    std::thread producer([&] {
+        ASSERT_FALSE(bounded.enqueue(1));
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    bounded.shutdown();
+    producer.join();
+    ASSERT_TRUE(bounded.empty());
+}
+
+/**
+ * Varios produtores bloqueados numa fila pequena e um consumidor que tira
+ * um elemento por vez: cada retirada acorda um unico produtor, e a vez
+ * tem que passar de um para outro sem que nenhum fique dormindo.
+ */
+TEST_F(BlockingQueueTest, ProducersHandOff) {
+    constexpr int producers = 4;
+    constexpr int per_producer = 5000;
+
+    structures::BlockingQueue<int, structures::ArrayQueue<int>> bounded{2u};
+    std::vector<std::thread> threads;
+    for (auto p = 0; p < producers; ++p) {
+        threads.emplace_back([&] {
+            for (auto i = 0; i < per_producer; ++i) {
+                bounded.enqueue(i);
+            }
+        });
+    }
+    for (auto i = 0; i < producers * per_producer; ++i) {
+        ASSERT_TRUE(bounded.dequeue());
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_TRUE(bounded.empty());
+}
+
+/**
+ * Produtores e consumidores (metade em lotes) numa fila limitada: cada valor
+ * deve sair exatamente uma vez e os consumidores terminam com close().
+ */
+TEST_F(BlockingQueueTest, ProducersAndConsumers) {
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+    constexpr int per_producer = 20000;
+    constexpr int total = producers * per_producer;
+
+    structures::BlockingQueue<int, structures::ArrayQueue<int>> bounded{64u};
+    std::vector<std::atomic<int>> seen(total);
+
+    std::vector<std::thread> threads;
+    for (auto p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (auto i = 0; i < per_producer; ++i) {
+                bounded.enqueue(p * per_producer + i);
+            }
+        });
+    }
+    std::vector<std::thread> readers;
+    for (auto c = 0; c < consumers; ++c) {
+        readers.emplace_back([&, c] {
+            if (c % 2 == 0) {
+                while (auto data = bounded.dequeue())
+                    seen[*data].fetch_add(1);
+                return;
+            }
+            int batch[16];
+            while (!bounded.closed() || !bounded.empty()) {
+                auto count = bounded.dequeue_batch(
+                    batch, 16u, std::chrono::milliseconds(5));
+                for (auto i = 0u; i < count; ++i) {
+                    seen[batch[i]].fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    bounded.close();
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    for (auto i = 0; i < total; ++i) {
+        ASSERT_EQ(1, seen[i].load()) << "value " << i;
+    }
+    ASSERT_TRUE(bounded.empty());
+}
@@ -0,0 +1,83 @@
+// Copyright [2017] <Luiz Motta>
+#include <sys/resource.h>
+
+#include <cstdint>
+#include <utility>
+
+#include "benchmark/benchmark.h"
+#include "../linked_queue/linked_queue.h"
+#include "chunked_linked_queue.h"
+
+/**
+ * Compara a LinkedQueue, que aloca um Node por elemento, com a fila em
+ * blocos numa rajada: enfileira n elementos e depois esvazia a fila.
+ *
+ * peak_bytes eh o maximo de memoria pedida ao alocador pela fila;
+ * max_rss eh o pico do processo inteiro (getrusage), entao so compara as
+ * duas filas rodando cada benchmark sozinho (--benchmark_filter).
+ */
+
+namespace {
+
+std::size_t live_bytes = 0u;
+std::size_t peak_bytes = 0u;
+
+/*!
+ * \brief HeapAllocator que conta os bytes alocados.
+ */
+struct CountingAllocator {
+    template<typename Node>
+    class rebind {
+     public:
+        using is_always_equal = std::true_type;
+
+        template<typename... Args>
+        Node* create(Args&&... args) {
+            live_bytes += sizeof(Node);
+            if (live_bytes > peak_bytes)
+                peak_bytes = live_bytes;
+            return new Node(std::forward<Args>(args)...);
+        }
+
+        void destroy(Node* node) {
+            live_bytes -= sizeof(Node);
+            delete node;
+        }
+    };
+};
+
+double max_rss_bytes() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<double>(usage.ru_maxrss) * 1024.0;
+}
+
+}  // namespace
+
+template<typename Queue>
+static void BM_Burst(benchmark::State& state) {
+    auto n = static_cast<int>(state.range(0));
+    live_bytes = 0u;
+    peak_bytes = 0u;
+    for (auto _ : state) {
+        Queue queue;
+        for (auto i = 0; i < n; ++i) {
+            queue.enqueue(i);
+        }
+        while (!queue.empty()) {
+            benchmark::DoNotOptimize(queue.dequeue());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n * 2);
+    state.counters["peak_bytes"] = static_cast<double>(peak_bytes);
+    state.counters["max_rss"] = max_rss_bytes();
+}
+
+BENCHMARK_TEMPLATE(BM_Burst,
+                   structures::LinkedQueue<int, CountingAllocator>)
+    ->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_Burst,
+                   structures::ChunkedLinkedQueue<int, CountingAllocator>)
+    ->Range(1 << 10, 1 << 22);
+
+BENCHMARK_MAIN();
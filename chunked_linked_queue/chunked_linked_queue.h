@@ -0,0 +1,520 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_CHUNKED_LINKED_QUEUE_H
+#define STRUCTURES_CHUNKED_LINKED_QUEUE_H
+
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../node_pool/node_pool.h"
+
+namespace structures {
+
+/*!
+ * \brief Quantos elementos cabem num bloco de cerca de 1KiB (no minimo 8).
+ */
+template<typename T>
+constexpr std::size_t chunked_capacity() {
+    constexpr std::size_t bytes = 1024u - sizeof(void*);
+    return bytes / sizeof(T) > 8u ? bytes / sizeof(T) : 8u;
+}
+
+/*!
+ * \brief Fila encadeada em blocos: cada bloco guarda N elementos em
+ * sequencia.
+ *
+ * Tem a mesma interface da LinkedQueue, mas enqueue so aloca um bloco a
+ * cada N elementos e dequeue so libera um bloco quando ele esvazia, e
+ * esvaziar a fila anda pela memoria em sequencia. Os blocos esvaziados
+ * ficam numa lista de reserva e sao reaproveitados pelos proximos
+ * enqueue; shrink_to_fit devolve a reserva ao alocador.
+ */
+template<typename T, typename Alloc = HeapAllocator,
+         std::size_t N = chunked_capacity<T>()>
+class ChunkedLinkedQueue {
+    class Block;
+
+ public:
+    /*!
+     * \brief Iterador do inicio para o final da fila.
+     *
+     * U eh T ou const T e M eh Block ou const Block.
+     */
+    template<typename U, typename M>
+    class Iterator {
+     public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = U*;
+        using reference = U&;
+
+        Iterator() = default;
+
+        Iterator(M* block, std::size_t offset, std::size_t index):
+            block_{block}, offset_{offset}, index_{index} {}
+
+        template<typename V, typename L, typename = typename std::enable_if<
+            std::is_convertible<L*, M*>::value>::type>
+        Iterator(const Iterator<V, L>& other):  // NOLINT
+            block_{other.block_}, offset_{other.offset_},
+            index_{other.index_} {}
+
+        reference operator*() const { return block_->data()[offset_]; }
+
+        pointer operator->() const { return block_->data() + offset_; }
+
+        Iterator& operator++() {
+            if (++offset_ == N) {
+                block_ = block_->next();
+                offset_ = 0u;
+            }
+            ++index_;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return index_ == other.index_;
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return index_ != other.index_;
+        }
+
+     private:
+        template<typename, typename> friend class Iterator;
+
+        M* block_{nullptr};
+        std::size_t offset_{0u};
+        std::size_t index_{0u};
+    };
+
+    using value_type = T;
+    using iterator = Iterator<T, Block>;
+    using const_iterator = Iterator<const T, const Block>;
+
+    /*!
+     * \brief Construtor da fila vazia
+     */
+    ChunkedLinkedQueue() = default;
+
+    /*!
+     * \brief Construtor de copia, copia todos os elementos de other
+     */
+    ChunkedLinkedQueue(const ChunkedLinkedQueue& other);
+
+    /*!
+     * \brief Construtor de movimento, assume os blocos de other sem alocar
+     */
+    ChunkedLinkedQueue(ChunkedLinkedQueue&& other) noexcept;
+
+    /*!
+     * \brief Atribuicao por copia
+     */
+    ChunkedLinkedQueue& operator=(const ChunkedLinkedQueue& other);
+
+    /*!
+     * \brief Atribuicao por movimento
+     */
+    ChunkedLinkedQueue& operator=(ChunkedLinkedQueue&& other) noexcept;
+
+    /*!
+     * \brief Destrutor
+     */
+    ~ChunkedLinkedQueue();
+
+    /*!
+     * \brief Troca o conteudo com outra fila em O(1)
+     */
+    void swap(ChunkedLinkedQueue& other) noexcept;
+
+    /*!
+     * \brief Remove todos os elementos da fila; os blocos vao para a
+     * reserva
+     */
+    void clear();
+
+    /*!
+     * \brief Devolve ao alocador os blocos da reserva
+     */
+    void shrink_to_fit();
+
+    /*!
+     * \brief Coloca um elemento no final da fila
+     *
+     * \param data, dado a ser armazenado
+     */
+    void enqueue(const T& data);
+
+    /*!
+     * \brief Coloca um elemento no final da fila, movendo o dado
+     *
+     * \param data, dado a ser armazenado
+     */
+    void enqueue(T&& data);
+
+    /*!
+     * \brief Constroi um elemento no final da fila
+     *
+     * \param args, argumentos repassados ao construtor de T
+     *
+     * \return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace(Args&&... args);
+
+    /*!
+     * \brief Retira o elemento do inicio da fila
+     *
+     * \return o dado que estava no inicio da fila
+     */
+    T dequeue();
+
+    /*!
+     * \brief Passa a referencia do dado que está no incio da fila
+     *
+     * \return referencia do primeiro dado da fila.
+     */
+    T& front() const;
+
+    /*!
+     * \brief Passa a referencia do dado que está no final da fila
+     *
+     * \return referencia do ultimo dado da fila.
+     */
+    T& back() const;
+
+    /*!
+     * \brief Verifica se a fila esta vazia
+     *
+     * \return true caso a fila esteja vazia, caso contrario false
+     */
+    bool empty() const;
+
+    /*!
+     * \brief Passa o tamanho da fila
+     *
+     * \return tamanho da fila
+     */
+    std::size_t size() const;
+
+    /*!
+     * \brief Iterador para o primeiro elemento
+     *
+     * \return iterador para o primeiro elemento
+     */
+    iterator begin();
+
+    /*!
+     * \brief Iterador constante para o primeiro elemento
+     *
+     * \return iterador constante para o primeiro elemento
+     */
+    const_iterator begin() const;
+
+    /*!
+     * \brief Iterador constante para o primeiro elemento
+     *
+     * \return iterador constante para o primeiro elemento
+     */
+    const_iterator cbegin() const;
+
+    /*!
+     * \brief Iterador para depois do ultimo elemento
+     *
+     * \return iterador para o fim
+     */
+    iterator end();
+
+    /*!
+     * \brief Iterador constante para depois do ultimo elemento
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator end() const;
+
+    /*!
+     * \brief Iterador constante para depois do ultimo elemento
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator cend() const;
+
+ private:
+    /*!
+     * \brief Espaco para N elementos; quem sabe quais posicoes estao
+     * construidas eh a fila (de first_ no head ate last_ no tail).
+     */
+    class Block {
+     public:
+        // Nao eh "= default" para que new Block() nao zere storage_.
+        Block() {}
+
+        Block(const Block&) = delete;
+
+        Block& operator=(const Block&) = delete;
+
+        T* data() { return std::launder(reinterpret_cast<T*>(storage_)); }
+
+        const T* data() const {
+            return std::launder(reinterpret_cast<const T*>(storage_));
+        }
+
+        Block* next() { return next_; }
+
+        const Block* next() const { return next_; }
+
+        void next(Block* block) { next_ = block; }
+
+     private:
+        Block* next_{nullptr};
+        alignas(T) unsigned char storage_[N * sizeof(T)];
+    };
+
+    Block* acquire();
+
+    void recycle(Block* block);
+
+    typename Alloc::template rebind<Block> alloc_;
+    Block* head{nullptr};
+    Block* tail{nullptr};
+    Block* spare{nullptr};
+    std::size_t first_{0u};
+    std::size_t last_{0u};
+    std::size_t size_{0u};
+};
+
+    template<typename T, typename Alloc, std::size_t N>
+    ChunkedLinkedQueue<T, Alloc, N>::ChunkedLinkedQueue(
+        const ChunkedLinkedQueue& other) :
+        alloc_{other.alloc_}
+    {
+        try {
+            for (auto& data : other)
+                enqueue(data);
+        } catch (...) {
+            clear();
+            shrink_to_fit();
+            throw;
+        }
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    ChunkedLinkedQueue<T, Alloc, N>::ChunkedLinkedQueue(
+        ChunkedLinkedQueue&& other) noexcept :
+        alloc_{std::move(other.alloc_)},
+        head{std::exchange(other.head, nullptr)},
+        tail{std::exchange(other.tail, nullptr)},
+        spare{std::exchange(other.spare, nullptr)},
+        first_{std::exchange(other.first_, 0u)},
+        last_{std::exchange(other.last_, 0u)},
+        size_{std::exchange(other.size_, 0u)}
+    {}
+
+    template<typename T, typename Alloc, std::size_t N>
+    ChunkedLinkedQueue<T, Alloc, N>&
+    ChunkedLinkedQueue<T, Alloc, N>::operator=(
+        const ChunkedLinkedQueue& other) {
+        if (this != &other) {
+            ChunkedLinkedQueue copy{other};
+            swap(copy);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    ChunkedLinkedQueue<T, Alloc, N>&
+    ChunkedLinkedQueue<T, Alloc, N>::operator=(
+        ChunkedLinkedQueue&& other) noexcept {
+        if (this != &other) {
+            ChunkedLinkedQueue moved{std::move(other)};
+            swap(moved);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    ChunkedLinkedQueue<T, Alloc, N>::~ChunkedLinkedQueue() {
+        clear();
+        shrink_to_fit();
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void ChunkedLinkedQueue<T, Alloc, N>::swap(
+        ChunkedLinkedQueue& other) noexcept {
+        std::swap(alloc_, other.alloc_);
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(spare, other.spare);
+        std::swap(first_, other.first_);
+        std::swap(last_, other.last_);
+        std::swap(size_, other.size_);
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void ChunkedLinkedQueue<T, Alloc, N>::clear() {
+        while (head != nullptr) {
+            auto end = head == tail ? last_ : N;
+            std::destroy(head->data() + first_, head->data() + end);
+            auto next = head->next();
+            recycle(head);
+            head = next;
+            first_ = 0u;
+        }
+        tail = nullptr;
+        last_ = 0u;
+        size_ = 0u;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void ChunkedLinkedQueue<T, Alloc, N>::shrink_to_fit() {
+        while (spare != nullptr) {
+            alloc_.destroy(std::exchange(spare, spare->next()));
+        }
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void ChunkedLinkedQueue<T, Alloc, N>::enqueue(const T& data) {
+        emplace(data);
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void ChunkedLinkedQueue<T, Alloc, N>::enqueue(T&& data) {
+        emplace(std::move(data));
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    template<typename... Args>
+    T& ChunkedLinkedQueue<T, Alloc, N>::emplace(Args&&... args) {
+        if (tail != nullptr && last_ < N) {
+            new (tail->data() + last_) T(std::forward<Args>(args)...);
+        } else {
+            // So liga o bloco novo depois que o elemento foi construido.
+            auto block = acquire();
+            try {
+                new (block->data()) T(std::forward<Args>(args)...);
+            } catch (...) {
+                recycle(block);
+                throw;
+            }
+            if (tail == nullptr)
+                head = block;
+            else
+                tail->next(block);
+            tail = block;
+            last_ = 0u;
+        }
+        ++size_;
+        return tail->data()[last_++];
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    T ChunkedLinkedQueue<T, Alloc, N>::dequeue() {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        auto slot = head->data() + first_;
+        auto data = std::move(*slot);
+        std::destroy_at(slot);
+        ++first_;
+        --size_;
+        if (empty()) {
+            // O ultimo bloco continua ligado para o proximo enqueue.
+            first_ = 0u;
+            last_ = 0u;
+        } else if (first_ == N) {
+            auto drained = head;
+            head = head->next();
+            recycle(drained);
+            first_ = 0u;
+        }
+        return data;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    T& ChunkedLinkedQueue<T, Alloc, N>::front() const {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        return head->data()[first_];
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    T& ChunkedLinkedQueue<T, Alloc, N>::back() const {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        return tail->data()[last_ - 1u];
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    bool ChunkedLinkedQueue<T, Alloc, N>::empty() const {
+        return size() == 0u;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    std::size_t ChunkedLinkedQueue<T, Alloc, N>::size() const { return size_; }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename ChunkedLinkedQueue<T, Alloc, N>::iterator
+    ChunkedLinkedQueue<T, Alloc, N>::begin() {
+        return iterator{head, first_, 0u};
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename ChunkedLinkedQueue<T, Alloc, N>::const_iterator
+    ChunkedLinkedQueue<T, Alloc, N>::begin() const {
+        return const_iterator{head, first_, 0u};
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename ChunkedLinkedQueue<T, Alloc, N>::const_iterator
+    ChunkedLinkedQueue<T, Alloc, N>::cbegin() const {
+        return begin();
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename ChunkedLinkedQueue<T, Alloc, N>::iterator
+    ChunkedLinkedQueue<T, Alloc, N>::end() {
+        return iterator{tail, last_, size_};
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename ChunkedLinkedQueue<T, Alloc, N>::const_iterator
+    ChunkedLinkedQueue<T, Alloc, N>::end() const {
+        return const_iterator{tail, last_, size_};
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename ChunkedLinkedQueue<T, Alloc, N>::const_iterator
+    ChunkedLinkedQueue<T, Alloc, N>::cend() const {
+        return end();
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename ChunkedLinkedQueue<T, Alloc, N>::Block*
+    ChunkedLinkedQueue<T, Alloc, N>::acquire() {
+        if (spare == nullptr)
+            return alloc_.create();
+        auto block = std::exchange(spare, spare->next());
+        block->next(nullptr);
+        return block;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void ChunkedLinkedQueue<T, Alloc, N>::recycle(Block* block) {
+        block->next(spare);
+        spare = block;
+    }
+
+}  // namespace structures
+
+#endif
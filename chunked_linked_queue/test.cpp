@@ -0,0 +1,198 @@
+/* Copyright [2017] <Luiz Motta> */
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "chunked_linked_queue.h"
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+/**
+ * Teste unitario para fila encadeada em blocos, com blocos de 4 elementos
+ */
+
+/**
+ * Politica de alocacao que conta os blocos criados e os ainda vivos
+ */
+struct CountingAllocator {
+    inline static std::size_t created = 0u;
+    inline static std::size_t live = 0u;
+
+    template<typename Node>
+    class rebind {
+     public:
+        using is_always_equal = std::true_type;
+
+        template<typename... Args>
+        Node* create(Args&&... args) {
+            ++created;
+            ++live;
+            return new Node(std::forward<Args>(args)...);
+        }
+
+        void destroy(Node* node) {
+            --live;
+            delete node;
+        }
+    };
+};
+
+class ChunkedLinkedQueueTest: public ::testing::Test {
+protected:
+    using Queue = structures::ChunkedLinkedQueue<int, CountingAllocator, 4u>;
+
+    void SetUp() override {
+        CountingAllocator::created = 0u;
+        CountingAllocator::live = 0u;
+    }
+
+    /**
+     * Elementos da fila, na ordem da iteracao
+     */
+    template<typename Q>
+    static auto values(const Q& queue) {
+        std::vector<typename Q::value_type> result;
+        for (const auto& data : queue) {
+            result.push_back(data);
+        }
+        EXPECT_EQ(result.size(), queue.size());
+        return result;
+    }
+
+    /**
+     * Fila na qual serao efetuadas as operações
+     */
+    Queue queue;
+};
+
+TEST_F(ChunkedLinkedQueueTest, EnqueueAndDequeue) {
+    ASSERT_TRUE(queue.empty());
+    ASSERT_THROW(queue.dequeue(), std::out_of_range);
+    ASSERT_THROW(queue.front(), std::out_of_range);
+    ASSERT_THROW(queue.back(), std::out_of_range);
+    for (auto i = 0; i < 10; ++i) {
+        queue.enqueue(i);
+        ASSERT_EQ(0, queue.front());
+        ASSERT_EQ(i, queue.back());
+    }
+    ASSERT_EQ(3u, CountingAllocator::created);
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(i, queue.front());
+        ASSERT_EQ(i, queue.dequeue());
+    }
+    ASSERT_TRUE(queue.empty());
+    ASSERT_THROW(queue.dequeue(), std::out_of_range);
+}
+
+/**
+ * Esvaziar a fila mantem o ultimo bloco ligado: voltar a enfileirar usa
+ * esse bloco, do inicio, sem alocar.
+ */
+TEST_F(ChunkedLinkedQueueTest, DrainKeepsLastBlock) {
+    for (auto round = 0; round < 10; ++round) {
+        for (auto i = 0; i < 3; ++i) {
+            queue.enqueue(round * 3 + i);
+        }
+        for (auto i = 0; i < 3; ++i) {
+            ASSERT_EQ(round * 3 + i, queue.dequeue());
+        }
+        ASSERT_TRUE(queue.empty());
+    }
+    ASSERT_EQ(1u, CountingAllocator::created);
+
+    // Enche o bloco mantido ate a borda e passa para o proximo.
+    for (auto i = 0; i < 5; ++i) {
+        queue.enqueue(i);
+    }
+    ASSERT_EQ(2u, CountingAllocator::created);
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3, 4}), values(queue));
+}
+
+TEST_F(ChunkedLinkedQueueTest, SpareBlocks) {
+    for (auto i = 0; i < 16; ++i) {
+        queue.enqueue(i);
+    }
+    ASSERT_EQ(4u, CountingAllocator::created);
+    // Os tres primeiros blocos esvaziam e vao para a reserva.
+    for (auto i = 0; i < 12; ++i) {
+        queue.dequeue();
+    }
+    ASSERT_EQ(4u, CountingAllocator::live);
+    for (auto i = 16; i < 28; ++i) {
+        queue.enqueue(i);
+    }
+    ASSERT_EQ(4u, CountingAllocator::created);
+    ASSERT_EQ(12, queue.front());
+    ASSERT_EQ(27, queue.back());
+
+    // clear manda todos os blocos para a reserva; shrink_to_fit os libera.
+    queue.clear();
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(4u, CountingAllocator::live);
+    queue.shrink_to_fit();
+    ASSERT_EQ(0u, CountingAllocator::live);
+    queue.enqueue(1);
+    ASSERT_EQ(5u, CountingAllocator::created);
+    ASSERT_EQ(1, queue.dequeue());
+}
+
+TEST_F(ChunkedLinkedQueueTest, IterationAcrossBlocks) {
+    std::vector<int> expected;
+    for (auto i = 0; i < 13; ++i) {
+        queue.enqueue(i);
+        expected.push_back(i);
+    }
+    for (auto i = 0; i < 6; ++i) {
+        queue.dequeue();
+        expected.erase(expected.begin());
+        ASSERT_EQ(expected, values(queue));
+    }
+    // Iteracao que para exatamente na borda de um bloco.
+    for (auto i = 13; i < 16; ++i) {
+        queue.enqueue(i);
+        expected.push_back(i);
+    }
+    ASSERT_EQ(expected, values(queue));
+    for (auto& data : queue) {
+        data *= 2;
+    }
+    const auto& constant = queue;
+    auto it = constant.begin();
+    for (auto i = 6; i < 16; ++i, ++it) {
+        ASSERT_EQ(2 * i, *it);
+    }
+    ASSERT_EQ(constant.end(), it);
+}
+
+TEST_F(ChunkedLinkedQueueTest, CopyAndMove) {
+    structures::ChunkedLinkedQueue<std::string, CountingAllocator, 4u> strings;
+    for (auto i = 0; i < 10; ++i) {
+        strings.enqueue(std::string(40, static_cast<char>('a' + i)));
+    }
+    strings.dequeue();
+    auto expected = values(strings);
+
+    auto copy = strings;
+    ASSERT_EQ(expected, values(copy));
+    copy.dequeue();
+    ASSERT_EQ(expected, values(strings));
+
+    auto moved = std::move(copy);
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(8u, moved.size());
+    copy.enqueue("again");
+    ASSERT_EQ("again", copy.front());
+
+    moved = strings;
+    ASSERT_EQ(expected, values(moved));
+    strings = std::move(moved);
+    ASSERT_EQ(expected, values(strings));
+
+    copy.swap(strings);
+    ASSERT_EQ(expected, values(copy));
+    ASSERT_EQ((std::vector<std::string>{"again"}), values(strings));
+}
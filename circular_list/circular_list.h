@@ -5,20 +5,60 @@
 
 #include <stdexcept>
 #include <cstdint>
+#include <utility>
+
+#include "../node_iterator/node_iterator.h"
+#include "../node_pool/node_pool.h"
 
 namespace structures {
 
 /*!
  * \brief Implementação de uma lista circular
  */
-template<typename T>
+template<typename T, typename Alloc = HeapAllocator>
 class CircularList {
+    class Node;
+
  public:
+    using value_type = T;
+    using iterator = ForwardNodeIterator<T, Node>;
+    using const_iterator = ForwardNodeIterator<const T, const Node>;
+
+    /*!
+     * \brief Construtor da lista vazia
+     */
+    CircularList() = default;
+
+    /*!
+     * \brief Construtor de copia, copia todos os elementos de other
+     */
+    CircularList(const CircularList& other);
+
+    /*!
+     * \brief Construtor de movimento, assume os Nodes de other sem alocar
+     */
+    CircularList(CircularList&& other) noexcept;
+
+    /*!
+     * \brief Atribuicao por copia
+     */
+    CircularList& operator=(const CircularList& other);
+
+    /*!
+     * \brief Atribuicao por movimento
+     */
+    CircularList& operator=(CircularList&& other) noexcept;
+
     /*!
      * \brief Destrutor
      */
     ~CircularList();
 
+    /*!
+     * \brief Troca o conteudo com outra lista em O(1)
+     */
+    void swap(CircularList& other) noexcept;
+
     /*!
      * \brief Limpa a lista
      */
@@ -31,6 +71,22 @@ class CircularList {
      */
     void push_back(const T& data);
 
+    /*!
+     * \brief Insere elemento no final da lista, movendo o dado
+     *
+     * @param data dado a ser inserido
+     */
+    void push_back(T&& data);
+
+    /*!
+     * \brief Constroi um elemento no final da lista
+     *
+     * @param args argumentos repassados ao construtor de T
+     * @return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace_back(Args&&... args);
+
     /*!
      * \brief Insere no inicio da lista
      *
@@ -38,6 +94,22 @@ class CircularList {
      */
     void push_front(const T& data);
 
+    /*!
+     * \brief Insere no inicio da lista, movendo o dado
+     *
+     * @param data dado a ser inserido
+     */
+    void push_front(T&& data);
+
+    /*!
+     * \brief Constroi um elemento no inicio da lista
+     *
+     * @param args argumentos repassados ao construtor de T
+     * @return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace_front(Args&&... args);
+
     /*!
      * \brief Insere na posicao indicada
      *
@@ -46,6 +118,24 @@ class CircularList {
      */
     void insert(const T& data, std::size_t index);
 
+    /*!
+     * \brief Insere na posicao indicada, movendo o dado
+     *
+     * @param data dado a ser inserido
+     * @param index posicao de insercao
+     */
+    void insert(T&& data, std::size_t index);
+
+    /*!
+     * \brief Constroi um elemento na posicao indicada
+     *
+     * @param index posicao de insercao
+     * @param args argumentos repassados ao construtor de T
+     * @return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace(std::size_t index, Args&&... args);
+
     /*!
      * \brief Insere elemento em ordem
      *
@@ -128,12 +218,56 @@ class CircularList {
      */
     std::size_t size() const;
 
+    /*!
+     * \brief Iterador para o primeiro elemento
+     *
+     * \return iterador para o primeiro elemento
+     */
+    iterator begin();
+
+    /*!
+     * \brief Iterador constante para o primeiro elemento
+     *
+     * \return iterador constante para o primeiro elemento
+     */
+    const_iterator begin() const;
+
+    /*!
+     * \brief Iterador constante para o primeiro elemento
+     *
+     * \return iterador constante para o primeiro elemento
+     */
+    const_iterator cbegin() const;
+
+    /*!
+     * \brief Iterador para depois do ultimo elemento
+     *
+     * \return iterador para o fim
+     */
+    iterator end();
+
+    /*!
+     * \brief Iterador constante para depois do ultimo elemento
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator end() const;
+
+    /*!
+     * \brief Iterador constante para depois do ultimo elemento
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator cend() const;
+
  private:
     class Node {
      public:
-        explicit Node(const T& data): data_{data} {}
-
-        Node(const T& data, Node* next): data_{data}, next_{next} {}
+        template<typename... Args>
+        Node(std::in_place_t, Node* next, Args&&... args):
+            data_(std::forward<Args>(args)...),
+            next_{next}
+        {}
 
         T& data() { return data_; }
 
@@ -160,44 +294,137 @@ class CircularList {
         return it;
     }
 
+    typename Alloc::template rebind<Node> alloc_;
     Node* head{nullptr};
     std::size_t size_{0u};
 };
 
-    template<typename T>
-    CircularList<T>::~CircularList() { clear(); }
+    template<typename T, typename Alloc>
+    CircularList<T, Alloc>::CircularList(const CircularList& other) :
+        alloc_{other.alloc_}
+    {
+        // Liga os Nodes em sequencia e fecha o anel no final, em vez de
+        // push_back, que percorre a lista a cada insercao.
+        Node* last = nullptr;
+        try {
+            for (auto& data : other) {
+                auto node = alloc_.create(std::in_place, nullptr, data);
+                if (last == nullptr)
+                    head = node;
+                else
+                    last->next(node);
+                last = node;
+                ++size_;
+            }
+        } catch (...) {
+            clear();
+            throw;
+        }
+        if (last != nullptr)
+            last->next(head);
+    }
+
+    template<typename T, typename Alloc>
+    CircularList<T, Alloc>::CircularList(CircularList&& other) noexcept :
+        alloc_{std::move(other.alloc_)},
+        head{std::exchange(other.head, nullptr)},
+        size_{std::exchange(other.size_, 0u)}
+    {}
+
+    template<typename T, typename Alloc>
+    CircularList<T, Alloc>& CircularList<T, Alloc>::operator=(
+        const CircularList& other) {
+        if (this != &other) {
+            CircularList copy{other};
+            swap(copy);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Alloc>
+    CircularList<T, Alloc>& CircularList<T, Alloc>::operator=(
+        CircularList&& other) noexcept {
+        if (this != &other) {
+            CircularList moved{std::move(other)};
+            swap(moved);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Alloc>
+    CircularList<T, Alloc>::~CircularList() { clear(); }
 
-    template<typename T>
-    void CircularList<T>::clear() {
+    template<typename T, typename Alloc>
+    void CircularList<T, Alloc>::swap(CircularList& other) noexcept {
+        std::swap(alloc_, other.alloc_);
+        std::swap(head, other.head);
+        std::swap(size_, other.size_);
+    }
+
+    template<typename T, typename Alloc>
+    void CircularList<T, Alloc>::clear() {
         while (!empty()) {
             pop_front();
         }
     }
 
-    template<typename T>
-    void CircularList<T>::push_back(const T &data) { insert(data, size()); }
+    template<typename T, typename Alloc>
+    void CircularList<T, Alloc>::push_back(const T &data) { insert(data, size()); }
 
-    template<typename T>
-    void CircularList<T>::push_front(const T &data) {
-        if (empty())
-            head = new Node(data);
-        else
-            head = new Node(data, head);
+    template<typename T, typename Alloc>
+    void CircularList<T, Alloc>::push_back(T&& data) {
+        insert(std::move(data), size());
+    }
+
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    T& CircularList<T, Alloc>::emplace_back(Args&&... args) {
+        return emplace(size(), std::forward<Args>(args)...);
+    }
+
+    template<typename T, typename Alloc>
+    void CircularList<T, Alloc>::push_front(const T &data) {
+        emplace_front(data);
+    }
+
+    template<typename T, typename Alloc>
+    void CircularList<T, Alloc>::push_front(T&& data) {
+        emplace_front(std::move(data));
+    }
+
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    T& CircularList<T, Alloc>::emplace_front(Args&&... args) {
+        head = alloc_.create(std::in_place, head, std::forward<Args>(args)...);
         ++size_;
         nodeAt(size() - 1)->next(head);
+        return head->data();
+    }
+
+    template<typename T, typename Alloc>
+    void CircularList<T, Alloc>::insert(const T &data, std::size_t index) {
+        emplace(index, data);
+    }
+
+    template<typename T, typename Alloc>
+    void CircularList<T, Alloc>::insert(T&& data, std::size_t index) {
+        emplace(index, std::move(data));
     }
 
-    template<typename T>
-    void CircularList<T>::insert(const T &data, std::size_t index) {
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    T& CircularList<T, Alloc>::emplace(std::size_t index, Args&&... args) {
         if (index == 0)
-            return push_front(data);
+            return emplace_front(std::forward<Args>(args)...);
         auto it = nodeAt(index - 1);
-        it->next(new Node(data, it->next()));
+        it->next(alloc_.create(std::in_place, it->next(),
+                               std::forward<Args>(args)...));
         ++size_;
+        return it->next()->data();
     }
 
-    template<typename T>
-    void CircularList<T>::insert_sorted(const T &data) {
+    template<typename T, typename Alloc>
+    void CircularList<T, Alloc>::insert_sorted(const T &data) {
         if (empty() || data <= head->data()) {
             return push_front(data);
         }
@@ -206,21 +433,21 @@ class CircularList {
             if (data < it->next()->data())
                 break;
         }
-        it->next(new Node(data, it->next()));
+        it->next(alloc_.create(std::in_place, it->next(), data));
         ++size_;
     }
 
-    template<typename T>
-    T &CircularList<T>::at(std::size_t index) {
+    template<typename T, typename Alloc>
+    T &CircularList<T, Alloc>::at(std::size_t index) {
         return nodeAt(index)->data(); }
 
-    template<typename T>
-    const T &CircularList<T>::at(std::size_t index) const {
+    template<typename T, typename Alloc>
+    const T &CircularList<T, Alloc>::at(std::size_t index) const {
         return nodeAt(index)->data();
     }
 
-    template<typename T>
-    T CircularList<T>::pop(std::size_t index) {
+    template<typename T, typename Alloc>
+    T CircularList<T, Alloc>::pop(std::size_t index) {
         if (index >= size_)
             throw std::out_of_range("INDEX OUT OF BOUNDS");
         if (index == 0)
@@ -230,44 +457,44 @@ class CircularList {
         auto data = std::move(to_delete->data());
         it->next(to_delete->next());
         --size_;
-        delete to_delete;
+        alloc_.destroy(to_delete);
         return data;
     }
 
-    template<typename T>
-    T CircularList<T>::pop_back() { return pop(size() - 1); }
+    template<typename T, typename Alloc>
+    T CircularList<T, Alloc>::pop_back() { return pop(size() - 1); }
 
-    template<typename T>
-    T CircularList<T>::pop_front() {
+    template<typename T, typename Alloc>
+    T CircularList<T, Alloc>::pop_front() {
         if (empty())
             throw std::out_of_range("EMPTY");
         auto to_delete = head;
         auto data = std::move(head->data());
         head = head->next();
         --size_;
-        delete to_delete;
+        alloc_.destroy(to_delete);
         return data;
     }
 
-    template<typename T>
-    void CircularList<T>::remove(const T &data) {
+    template<typename T, typename Alloc>
+    void CircularList<T, Alloc>::remove(const T &data) {
         auto it = nodeAt(find(data)-1);
         auto to_delete = it->next();
         it->next(to_delete->next());
-        delete to_delete;
+        alloc_.destroy(to_delete);
         --size_;
     }
 
-    template<typename T>
-    bool CircularList<T>::empty() const { return size() == 0u; }
+    template<typename T, typename Alloc>
+    bool CircularList<T, Alloc>::empty() const { return size() == 0u; }
 
-    template<typename T>
-    bool CircularList<T>::contains(const T &data) const {
+    template<typename T, typename Alloc>
+    bool CircularList<T, Alloc>::contains(const T &data) const {
         return find(data) != size();
     }
 
-    template<typename T>
-    std::size_t CircularList<T>::find(const T &data) const {
+    template<typename T, typename Alloc>
+    std::size_t CircularList<T, Alloc>::find(const T &data) const {
         auto it = head;
         std::size_t index = 0u;
         while (it != nullptr && it->data() != data && index < size()) {
@@ -277,8 +504,44 @@ class CircularList {
         return index;
     }
 
-    template<typename T>
-    std::size_t CircularList<T>::size() const { return size_; }
+    template<typename T, typename Alloc>
+    std::size_t CircularList<T, Alloc>::size() const { return size_; }
+
+    template<typename T, typename Alloc>
+    typename CircularList<T, Alloc>::iterator
+    CircularList<T, Alloc>::begin() {
+        return iterator{head, 0u};
+    }
+
+    template<typename T, typename Alloc>
+    typename CircularList<T, Alloc>::const_iterator
+    CircularList<T, Alloc>::begin() const {
+        return const_iterator{head, 0u};
+    }
+
+    template<typename T, typename Alloc>
+    typename CircularList<T, Alloc>::const_iterator
+    CircularList<T, Alloc>::cbegin() const {
+        return begin();
+    }
+
+    template<typename T, typename Alloc>
+    typename CircularList<T, Alloc>::iterator
+    CircularList<T, Alloc>::end() {
+        return iterator{head, size_};
+    }
+
+    template<typename T, typename Alloc>
+    typename CircularList<T, Alloc>::const_iterator
+    CircularList<T, Alloc>::end() const {
+        return const_iterator{head, size_};
+    }
+
+    template<typename T, typename Alloc>
+    typename CircularList<T, Alloc>::const_iterator
+    CircularList<T, Alloc>::cend() const {
+        return end();
+    }
 
 }  // namespace structures
 
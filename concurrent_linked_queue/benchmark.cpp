@@ -0,0 +1,55 @@
+// Copyright [2017] <Luiz Motta>
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <thread>
+
+#include "../linked_queue/linked_queue.h"
+#include "concurrent_linked_queue.h"
+
+/**
+ * Escalabilidade de enqueue/dequeue de 1 ate N threads:
+ * ConcurrentLinkedQueue contra LinkedQueue protegida por mutex.
+ */
+
+namespace {
+
+int max_threads() {
+    auto n = static_cast<int>(std::thread::hardware_concurrency());
+    return n < 2 ? 2 : n;
+}
+
+structures::ConcurrentLinkedQueue<int> concurrent_queue;
+
+std::mutex mutex;
+structures::LinkedQueue<int> locked_queue;
+
+}  // namespace
+
+static void BM_ConcurrentLinkedQueue(benchmark::State& state) {
+    for (auto _ : state) {
+        concurrent_queue.enqueue(state.thread_index());
+        benchmark::DoNotOptimize(concurrent_queue.dequeue());
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+static void BM_MutexLinkedQueue(benchmark::State& state) {
+    for (auto _ : state) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            locked_queue.enqueue(state.thread_index());
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!locked_queue.empty())
+            benchmark::DoNotOptimize(locked_queue.dequeue());
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+BENCHMARK(BM_ConcurrentLinkedQueue)->ThreadRange(1, max_threads())
+    ->UseRealTime();
+BENCHMARK(BM_MutexLinkedQueue)->ThreadRange(1, max_threads())
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
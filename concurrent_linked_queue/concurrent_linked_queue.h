@@ -0,0 +1,202 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_CONCURRENT_LINKED_QUEUE_H
+#define STRUCTURES_CONCURRENT_LINKED_QUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#include "../hazard_pointer/hazard_pointer.h"
+
+namespace structures {
+
+/*!
+ * \brief ConcurrentLinkedQueue implementa uma fila encadeada sem locks para
+ * varios produtores e consumidores (algoritmo de Michael e Scott).
+ *
+ * A fila sempre tem um Node sentinela em head; o primeiro elemento fica em
+ * head->next(). Nodes removidos sao liberados por hazard pointers, entao
+ * uma thread nunca acessa um Node ja liberado por outra.
+ */
+template<typename T>
+class ConcurrentLinkedQueue {
+ public:
+    /*!
+     * \brief Construtor, cria a fila vazia com o sentinela
+     */
+    ConcurrentLinkedQueue();
+
+    ConcurrentLinkedQueue(const ConcurrentLinkedQueue&) = delete;
+
+    ConcurrentLinkedQueue& operator=(const ConcurrentLinkedQueue&) = delete;
+
+    /*!
+     * \brief Destrutor; nao pode haver outras threads usando a fila
+     */
+    ~ConcurrentLinkedQueue();
+
+    /*!
+     * \brief Coloca um elemento no final da fila
+     *
+     * \param data, dado a ser armazenado
+     */
+    void enqueue(const T& data);
+
+    /*!
+     * \brief Coloca um elemento no final da fila, movendo o dado
+     *
+     * \param data, dado a ser armazenado
+     */
+    void enqueue(T&& data);
+
+    /*!
+     * \brief Constroi um elemento no final da fila
+     *
+     * \param args, argumentos repassados ao construtor de T
+     */
+    template<typename... Args>
+    void emplace(Args&&... args);
+
+    /*!
+     * \brief Retira o elemento do inicio da fila
+     *
+     * \return o dado retirado, ou std::nullopt se a fila estiver vazia
+     */
+    std::optional<T> dequeue();
+
+    /*!
+     * \brief Verifica se a fila esta vazia
+     *
+     * \return true caso a fila pareca vazia no momento da chamada
+     */
+    bool empty() const;
+
+    /*!
+     * \brief Passa o tamanho aproximado da fila
+     *
+     * \return tamanho da fila
+     */
+    std::size_t size() const;
+
+ private:
+    class Node {
+     public:
+        Node() = default;
+
+        template<typename... Args>
+        explicit Node(std::in_place_t, Args&&... args):
+            data_{std::in_place, std::forward<Args>(args)...} {}
+
+        T& data() { return *data_; }
+
+        std::atomic<Node*>& next() { return next_; }
+
+     private:
+        std::optional<T> data_;
+        std::atomic<Node*> next_{nullptr};
+    };
+
+    void link(Node* node);
+
+    alignas(64) std::atomic<Node*> head{nullptr};
+    alignas(64) std::atomic<Node*> tail{nullptr};
+    alignas(64) std::atomic<std::size_t> size_{0u};
+};
+
+    template<typename T>
+    ConcurrentLinkedQueue<T>::ConcurrentLinkedQueue() {
+        auto sentinel = new Node();
+        head.store(sentinel);
+        tail.store(sentinel);
+    }
+
+    template<typename T>
+    ConcurrentLinkedQueue<T>::~ConcurrentLinkedQueue() {
+        auto it = head.load(std::memory_order_relaxed);
+        while (it != nullptr) {
+            auto next = it->next().load(std::memory_order_relaxed);
+            delete it;
+            it = next;
+        }
+    }
+
+    template<typename T>
+    void ConcurrentLinkedQueue<T>::enqueue(const T& data) { emplace(data); }
+
+    template<typename T>
+    void ConcurrentLinkedQueue<T>::enqueue(T&& data) {
+        emplace(std::move(data));
+    }
+
+    template<typename T>
+    template<typename... Args>
+    void ConcurrentLinkedQueue<T>::emplace(Args&&... args) {
+        link(new Node(std::in_place, std::forward<Args>(args)...));
+    }
+
+    template<typename T>
+    void ConcurrentLinkedQueue<T>::link(Node* node) {
+        // Conta antes de ligar para que size_ nunca fique negativo.
+        size_.fetch_add(1u, std::memory_order_relaxed);
+        HazardPointer hp;
+        while (true) {
+            auto last = hp.protect(tail);
+            auto next = last->next().load(std::memory_order_acquire);
+            if (last != tail.load())
+                continue;
+            if (next != nullptr) {
+                // Outra thread ligou um Node mas ainda nao avancou tail.
+                tail.compare_exchange_weak(last, next);
+                continue;
+            }
+            if (last->next().compare_exchange_weak(
+                    next, node, std::memory_order_release,
+                    std::memory_order_relaxed)) {
+                tail.compare_exchange_strong(last, node);
+                break;
+            }
+        }
+    }
+
+    template<typename T>
+    std::optional<T> ConcurrentLinkedQueue<T>::dequeue() {
+        HazardPointer hp_first;
+        HazardPointer hp_next;
+        while (true) {
+            auto first = hp_first.protect(head);
+            auto last = tail.load();
+            auto next = first->next().load(std::memory_order_acquire);
+            hp_next.set(next);
+            if (first != head.load())
+                continue;
+            if (next == nullptr)
+                return std::nullopt;
+            if (first == last) {
+                tail.compare_exchange_weak(last, next);
+                continue;
+            }
+            if (head.compare_exchange_strong(first, next)) {
+                // next vira o novo sentinela; so quem avancou head le o dado.
+                std::optional<T> data{std::move(next->data())};
+                hp_next.reset();
+                hp_first.reset();
+                retire(first);
+                size_.fetch_sub(1u, std::memory_order_relaxed);
+                return data;
+            }
+        }
+    }
+
+    template<typename T>
+    bool ConcurrentLinkedQueue<T>::empty() const { return size() == 0u; }
+
+    template<typename T>
+    std::size_t ConcurrentLinkedQueue<T>::size() const {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+}  // namespace structures
+
+#endif
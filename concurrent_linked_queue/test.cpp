@@ -0,0 +1,111 @@
+/* Copyright [2017] <Luiz Motta> */
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "concurrent_linked_queue.h"
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+/**
+ * Teste unitario para fila encadeada concorrente
+ */
+
+class ConcurrentLinkedQueueTest: public ::testing::Test {
+protected:
+    /**
+     * Fila na qual serao efetuadas as operações
+     */
+    structures::ConcurrentLinkedQueue<int> queue{};
+};
+
+TEST_F(ConcurrentLinkedQueueTest, Empty) {
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.dequeue().has_value());
+}
+
+TEST_F(ConcurrentLinkedQueueTest, Fifo) {
+    for (auto i = 0; i < 10; ++i) {
+        queue.enqueue(i);
+    }
+    ASSERT_EQ(10u, queue.size());
+    for (auto i = 0; i < 10; ++i) {
+        auto data = queue.dequeue();
+        ASSERT_TRUE(data.has_value());
+        ASSERT_EQ(i, *data);
+    }
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.dequeue().has_value());
+}
+
+TEST_F(ConcurrentLinkedQueueTest, MoveOnlyAndStrings) {
+    structures::ConcurrentLinkedQueue<std::unique_ptr<std::string>> strings;
+    strings.emplace(new std::string("a string longer than the sso buffer"));
+    strings.enqueue(std::make_unique<std::string>("b"));
+    ASSERT_EQ("a string longer than the sso buffer", **strings.dequeue());
+    ASSERT_EQ("b", **strings.dequeue());
+}
+
+TEST_F(ConcurrentLinkedQueueTest, DestroyWithElements) {
+    structures::ConcurrentLinkedQueue<std::string> strings;
+    for (auto i = 0; i < 100; ++i) {
+        strings.enqueue(std::string(64, 'x'));
+    }
+}
+
+/**
+ * Varios produtores e consumidores: cada valor deve sair exatamente uma
+ * vez e, para cada consumidor, os valores de um mesmo produtor devem sair
+ * em ordem.
+ */
+TEST_F(ConcurrentLinkedQueueTest, MultiProducerMultiConsumer) {
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+    constexpr int per_producer = 20000;
+    constexpr int total = producers * per_producer;
+
+    std::vector<std::atomic<int>> seen(total);
+    std::atomic<int> consumed{0};
+    std::atomic<bool> ordered{true};
+
+    std::vector<std::thread> threads;
+    for (auto p = 0; p < producers; ++p) {
+        threads.emplace_back([this, p] {
+            for (auto i = 0; i < per_producer; ++i) {
+                queue.enqueue(p * per_producer + i);
+            }
+        });
+    }
+    for (auto c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            std::vector<int> last(producers, -1);
+            while (consumed.load() < total) {
+                auto data = queue.dequeue();
+                if (!data) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                auto producer = *data / per_producer;
+                if (*data <= last[producer])
+                    ordered = false;
+                last[producer] = *data;
+                seen[*data].fetch_add(1);
+                consumed.fetch_add(1);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_TRUE(ordered);
+    for (auto i = 0; i < total; ++i) {
+        ASSERT_EQ(1, seen[i].load()) << "value " << i;
+    }
+    ASSERT_TRUE(queue.empty());
+}
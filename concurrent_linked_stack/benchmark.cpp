@@ -0,0 +1,55 @@
+// Copyright [2017] <Luiz Motta>
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <thread>
+
+#include "../linked_stack/linked_stack.h"
+#include "concurrent_linked_stack.h"
+
+/**
+ * Escalabilidade de push/pop de 1 ate N threads: ConcurrentLinkedStack
+ * contra LinkedStack protegida por mutex.
+ */
+
+namespace {
+
+int max_threads() {
+    auto n = static_cast<int>(std::thread::hardware_concurrency());
+    return n < 2 ? 2 : n;
+}
+
+structures::ConcurrentLinkedStack<int> concurrent_stack;
+
+std::mutex mutex;
+structures::LinkedStack<int> locked_stack;
+
+}  // namespace
+
+static void BM_ConcurrentLinkedStack(benchmark::State& state) {
+    for (auto _ : state) {
+        concurrent_stack.push(state.thread_index());
+        benchmark::DoNotOptimize(concurrent_stack.pop());
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+static void BM_MutexLinkedStack(benchmark::State& state) {
+    for (auto _ : state) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            locked_stack.push(state.thread_index());
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!locked_stack.empty())
+            benchmark::DoNotOptimize(locked_stack.pop());
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+BENCHMARK(BM_ConcurrentLinkedStack)->ThreadRange(1, max_threads())
+    ->UseRealTime();
+BENCHMARK(BM_MutexLinkedStack)->ThreadRange(1, max_threads())
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,288 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_CONCURRENT_LINKED_STACK_H
+#define STRUCTURES_CONCURRENT_LINKED_STACK_H
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+namespace structures {
+
+/*!
+ * \brief ConcurrentLinkedStack implementa uma pilha encadeada sem locks
+ * (pilha de Treiber) com eliminacao.
+ *
+ * O topo eh um ponteiro com tag de 16 bits nos bits altos (enderecos de
+ * 48 bits), incrementada a cada troca, o que evita o problema ABA. Nodes
+ * retirados voltam para uma free list interna, tambem com tag, e so sao
+ * liberados no destrutor; por isso ler next() de um Node que outra thread
+ * acabou de retirar eh seguro.
+ *
+ * Quando o CAS no topo falha, a operacao tenta se encontrar com uma
+ * operacao oposta num vetor de eliminacao: um push oferece seu Node num
+ * slot aleatorio por um curto periodo e um pop que encontre o Node o
+ * consome sem tocar no topo.
+ */
+template<typename T>
+class ConcurrentLinkedStack {
+ public:
+    /*!
+     * \brief Construtor da pilha vazia
+     */
+    ConcurrentLinkedStack() = default;
+
+    ConcurrentLinkedStack(const ConcurrentLinkedStack&) = delete;
+
+    ConcurrentLinkedStack& operator=(const ConcurrentLinkedStack&) = delete;
+
+    /*!
+     * \brief Destrutor; nao pode haver outras threads usando a pilha
+     */
+    ~ConcurrentLinkedStack();
+
+    /*!
+     * \brief Coloca um elemento no topo da pilha
+     *
+     * \param data, dado a ser armazenado
+     */
+    void push(const T& data);
+
+    /*!
+     * \brief Coloca um elemento no topo da pilha, movendo o dado
+     *
+     * \param data, dado a ser armazenado
+     */
+    void push(T&& data);
+
+    /*!
+     * \brief Constroi um elemento no topo da pilha
+     *
+     * \param args, argumentos repassados ao construtor de T
+     */
+    template<typename... Args>
+    void emplace(Args&&... args);
+
+    /*!
+     * \brief Retira o elemento que está no topo da pilha
+     *
+     * \return o dado retirado, ou std::nullopt se a pilha estiver vazia
+     */
+    std::optional<T> pop();
+
+    /*!
+     * \brief Verifica se a pilha esta vazia
+     *
+     * \return true caso a pilha pareca vazia no momento da chamada
+     */
+    bool empty() const;
+
+    /*!
+     * \brief Passa o tamanho aproximado da pilha
+     *
+     * \return tamanho da pilha
+     */
+    std::size_t size() const;
+
+ private:
+    class Node {
+     public:
+        std::optional<T>& data() { return data_; }
+
+        Node* next() const { return next_.load(std::memory_order_relaxed); }
+
+        void next(Node* node) { next_.store(node, std::memory_order_relaxed); }
+
+     private:
+        std::optional<T> data_;
+        std::atomic<Node*> next_{nullptr};
+    };
+
+    struct alignas(64) Slot {
+        std::atomic<Node*> node{nullptr};
+    };
+
+    static constexpr int TAG_SHIFT = 48;
+    static constexpr std::uint64_t POINTER_MASK =
+        (std::uint64_t{1} << TAG_SHIFT) - 1;
+    static constexpr std::size_t ELIMINATION_SIZE = 16u;
+    static constexpr int ELIMINATION_SPINS = 128;
+
+    static_assert(sizeof(void*) == 8, "tag requer ponteiros de 64 bits");
+
+    static Node* pointer(std::uint64_t tagged) {
+        return reinterpret_cast<Node*>(tagged & POINTER_MASK);
+    }
+
+    static std::uint64_t retag(std::uint64_t old, Node* node) {
+        auto tag = (old >> TAG_SHIFT) + 1;
+        return (tag << TAG_SHIFT) | reinterpret_cast<std::uintptr_t>(node);
+    }
+
+    static bool push_node(std::atomic<std::uint64_t>& top, Node* node);
+
+    static Node* pop_node(std::atomic<std::uint64_t>& top);
+
+    void link(Node* node);
+
+    Node* new_node();
+
+    bool offer(Node* node);
+
+    Node* take();
+
+    static std::size_t random_slot();
+
+    alignas(64) std::atomic<std::uint64_t> top_{0u};
+    alignas(64) std::atomic<std::uint64_t> free_{0u};
+    alignas(64) std::atomic<std::size_t> size_{0u};
+    Slot elimination_[ELIMINATION_SIZE];
+};
+
+    template<typename T>
+    ConcurrentLinkedStack<T>::~ConcurrentLinkedStack() {
+        for (auto top : {&top_, &free_}) {
+            auto it = pointer(top->load(std::memory_order_relaxed));
+            while (it != nullptr) {
+                auto next = it->next();
+                delete it;
+                it = next;
+            }
+        }
+    }
+
+    template<typename T>
+    void ConcurrentLinkedStack<T>::push(const T& data) { emplace(data); }
+
+    template<typename T>
+    void ConcurrentLinkedStack<T>::push(T&& data) {
+        emplace(std::move(data));
+    }
+
+    template<typename T>
+    template<typename... Args>
+    void ConcurrentLinkedStack<T>::emplace(Args&&... args) {
+        auto node = new_node();
+        node->data().emplace(std::forward<Args>(args)...);
+        link(node);
+    }
+
+    template<typename T>
+    void ConcurrentLinkedStack<T>::link(Node* node) {
+        size_.fetch_add(1u, std::memory_order_relaxed);
+        while (!push_node(top_, node)) {
+            if (offer(node))
+                return;
+        }
+    }
+
+    template<typename T>
+    std::optional<T> ConcurrentLinkedStack<T>::pop() {
+        Node* node;
+        while (true) {
+            auto old = top_.load(std::memory_order_acquire);
+            node = pointer(old);
+            if (node == nullptr)
+                return std::nullopt;
+            if (top_.compare_exchange_weak(old, retag(old, node->next()),
+                                           std::memory_order_acquire,
+                                           std::memory_order_relaxed))
+                break;
+            // Contencao no topo: tenta encontrar um push no vetor.
+            node = take();
+            if (node != nullptr)
+                break;
+        }
+        size_.fetch_sub(1u, std::memory_order_relaxed);
+        std::optional<T> data{std::move(node->data())};
+        node->data().reset();
+        while (!push_node(free_, node)) {}
+        return data;
+    }
+
+    template<typename T>
+    bool ConcurrentLinkedStack<T>::empty() const { return size() == 0u; }
+
+    template<typename T>
+    std::size_t ConcurrentLinkedStack<T>::size() const {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    bool ConcurrentLinkedStack<T>::push_node(std::atomic<std::uint64_t>& top,
+                                             Node* node) {
+        auto old = top.load(std::memory_order_relaxed);
+        node->next(pointer(old));
+        return top.compare_exchange_weak(old, retag(old, node),
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    typename ConcurrentLinkedStack<T>::Node*
+    ConcurrentLinkedStack<T>::pop_node(std::atomic<std::uint64_t>& top) {
+        auto old = top.load(std::memory_order_acquire);
+        while (pointer(old) != nullptr) {
+            // next() pode ser de um Node ja reutilizado; a tag faz o CAS
+            // falhar nesse caso.
+            auto next = pointer(old)->next();
+            if (top.compare_exchange_weak(old, retag(old, next),
+                                          std::memory_order_acquire,
+                                          std::memory_order_acquire))
+                return pointer(old);
+        }
+        return nullptr;
+    }
+
+    template<typename T>
+    typename ConcurrentLinkedStack<T>::Node*
+    ConcurrentLinkedStack<T>::new_node() {
+        auto node = pop_node(free_);
+        return node != nullptr ? node : new Node();
+    }
+
+    template<typename T>
+    bool ConcurrentLinkedStack<T>::offer(Node* node) {
+        auto& slot = elimination_[random_slot()].node;
+        Node* expected = nullptr;
+        if (!slot.compare_exchange_strong(expected, node,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed))
+            return false;
+        for (auto i = 0; i < ELIMINATION_SPINS; ++i) {
+            if (slot.load(std::memory_order_relaxed) != node)
+                return true;
+        }
+        // Se nao conseguir retirar a oferta, um pop ja levou o Node.
+        expected = node;
+        return !slot.compare_exchange_strong(expected, nullptr,
+                                             std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    typename ConcurrentLinkedStack<T>::Node* ConcurrentLinkedStack<T>::take() {
+        auto& slot = elimination_[random_slot()].node;
+        auto node = slot.load(std::memory_order_relaxed);
+        if (node != nullptr &&
+            slot.compare_exchange_strong(node, nullptr,
+                                         std::memory_order_acquire,
+                                         std::memory_order_relaxed))
+            return node;
+        return nullptr;
+    }
+
+    template<typename T>
+    std::size_t ConcurrentLinkedStack<T>::random_slot() {
+        // xorshift por thread; so precisa espalhar as threads pelos slots.
+        thread_local std::uint32_t state = static_cast<std::uint32_t>(
+            reinterpret_cast<std::uintptr_t>(&state) >> 4) | 1u;
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state % ELIMINATION_SIZE;
+    }
+
+}  // namespace structures
+
+#endif
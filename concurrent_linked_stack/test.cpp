@@ -0,0 +1,106 @@
+/* Copyright [2017] <Luiz Motta> */
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "concurrent_linked_stack.h"
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+/**
+ * Teste unitario para pilha encadeada concorrente
+ */
+
+class ConcurrentLinkedStackTest: public ::testing::Test {
+protected:
+    /**
+     * Pilha na qual serao efetuadas as operações
+     */
+    structures::ConcurrentLinkedStack<int> stack{};
+};
+
+TEST_F(ConcurrentLinkedStackTest, Empty) {
+    ASSERT_TRUE(stack.empty());
+    ASSERT_FALSE(stack.pop().has_value());
+}
+
+TEST_F(ConcurrentLinkedStackTest, Lifo) {
+    for (auto i = 0; i < 10; ++i) {
+        stack.push(i);
+    }
+    ASSERT_EQ(10u, stack.size());
+    for (auto i = 9; i >= 0; --i) {
+        auto data = stack.pop();
+        ASSERT_TRUE(data.has_value());
+        ASSERT_EQ(i, *data);
+    }
+    ASSERT_TRUE(stack.empty());
+    ASSERT_FALSE(stack.pop().has_value());
+}
+
+TEST_F(ConcurrentLinkedStackTest, MoveOnlyAndStrings) {
+    structures::ConcurrentLinkedStack<std::unique_ptr<std::string>> strings;
+    strings.emplace(new std::string("a string longer than the sso buffer"));
+    strings.push(std::make_unique<std::string>("b"));
+    ASSERT_EQ("b", **strings.pop());
+    ASSERT_EQ("a string longer than the sso buffer", **strings.pop());
+}
+
+TEST_F(ConcurrentLinkedStackTest, DestroyWithElements) {
+    structures::ConcurrentLinkedStack<std::string> strings;
+    for (auto i = 0; i < 100; ++i) {
+        strings.push(std::string(64, 'x'));
+    }
+    for (auto i = 0; i < 50; ++i) {
+        strings.pop();
+    }
+}
+
+/**
+ * Varias threads fazendo push e pop ao mesmo tempo: cada valor deve sair
+ * exatamente uma vez, seja pelo topo ou pelo vetor de eliminacao.
+ */
+TEST_F(ConcurrentLinkedStackTest, MultiProducerMultiConsumer) {
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+    constexpr int per_producer = 20000;
+    constexpr int total = producers * per_producer;
+
+    std::vector<std::atomic<int>> seen(total);
+    std::atomic<int> consumed{0};
+
+    std::vector<std::thread> threads;
+    for (auto p = 0; p < producers; ++p) {
+        threads.emplace_back([this, p] {
+            for (auto i = 0; i < per_producer; ++i) {
+                stack.push(p * per_producer + i);
+            }
+        });
+    }
+    for (auto c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            while (consumed.load() < total) {
+                auto data = stack.pop();
+                if (!data) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                seen[*data].fetch_add(1);
+                consumed.fetch_add(1);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto i = 0; i < total; ++i) {
+        ASSERT_EQ(1, seen[i].load()) << "value " << i;
+    }
+    ASSERT_TRUE(stack.empty());
+}
@@ -5,20 +5,60 @@
 
 #include <stdexcept>
 #include <cstdint>
+#include <utility>
+
+#include "../node_iterator/node_iterator.h"
+#include "../node_pool/node_pool.h"
 
 namespace structures {
 
 /*!
  * \brief Implementação de uma lista circular encadeada
  */
-template<typename T>
+template<typename T, typename Alloc = HeapAllocator>
 class DoublyCircularList {
+    class Node;
+
  public:
+    using value_type = T;
+    using iterator = BidirectionalNodeIterator<T, Node>;
+    using const_iterator = BidirectionalNodeIterator<const T, const Node>;
+
+    /*!
+     * \brief Construtor da lista vazia
+     */
+    DoublyCircularList() = default;
+
+    /*!
+     * \brief Construtor de copia, copia todos os elementos de other
+     */
+    DoublyCircularList(const DoublyCircularList& other);
+
+    /*!
+     * \brief Construtor de movimento, assume os Nodes de other sem alocar
+     */
+    DoublyCircularList(DoublyCircularList&& other) noexcept;
+
+    /*!
+     * \brief Atribuicao por copia
+     */
+    DoublyCircularList& operator=(const DoublyCircularList& other);
+
+    /*!
+     * \brief Atribuicao por movimento
+     */
+    DoublyCircularList& operator=(DoublyCircularList&& other) noexcept;
+
     /*!
      * \brief Destrutor
      */
     ~DoublyCircularList();
 
+    /*!
+     * \brief Troca o conteudo com outra lista em O(1)
+     */
+    void swap(DoublyCircularList& other) noexcept;
+
     /*!
      * \brief Limpa a lista
      */
@@ -31,6 +71,22 @@ class DoublyCircularList {
      */
     void push_back(const T& data);
 
+    /*!
+     * \brief Insere elemento no final da lista, movendo o dado
+     *
+     * @param data dado a ser inserido
+     */
+    void push_back(T&& data);
+
+    /*!
+     * \brief Constroi um elemento no final da lista
+     *
+     * @param args argumentos repassados ao construtor de T
+     * @return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace_back(Args&&... args);
+
     /*!
      * \brief Insere no inicio da lista
      *
@@ -38,6 +94,22 @@ class DoublyCircularList {
      */
     void push_front(const T& data);
 
+    /*!
+     * \brief Insere no inicio da lista, movendo o dado
+     *
+     * @param data dado a ser inserido
+     */
+    void push_front(T&& data);
+
+    /*!
+     * \brief Constroi um elemento no inicio da lista
+     *
+     * @param args argumentos repassados ao construtor de T
+     * @return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace_front(Args&&... args);
+
     /*!
      * \brief Insere na posicao indicada
      *
@@ -46,6 +118,24 @@ class DoublyCircularList {
      */
     void insert(const T& data, std::size_t index);
 
+    /*!
+     * \brief Insere na posicao indicada, movendo o dado
+     *
+     * @param data dado a ser inserido
+     * @param index posicao de insercao
+     */
+    void insert(T&& data, std::size_t index);
+
+    /*!
+     * \brief Constroi um elemento na posicao indicada
+     *
+     * @param index posicao de insercao
+     * @param args argumentos repassados ao construtor de T
+     * @return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace(std::size_t index, Args&&... args);
+
     /*!
      * \brief Insere elemento em ordem
      *
@@ -128,15 +218,57 @@ class DoublyCircularList {
      */
     std::size_t size() const;
 
+    /*!
+     * \brief Iterador para o primeiro elemento
+     *
+     * \return iterador para o primeiro elemento
+     */
+    iterator begin();
+
+    /*!
+     * \brief Iterador constante para o primeiro elemento
+     *
+     * \return iterador constante para o primeiro elemento
+     */
+    const_iterator begin() const;
+
+    /*!
+     * \brief Iterador constante para o primeiro elemento
+     *
+     * \return iterador constante para o primeiro elemento
+     */
+    const_iterator cbegin() const;
+
+    /*!
+     * \brief Iterador para depois do ultimo elemento
+     *
+     * \return iterador para o fim
+     */
+    iterator end();
+
+    /*!
+     * \brief Iterador constante para depois do ultimo elemento
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator end() const;
+
+    /*!
+     * \brief Iterador constante para depois do ultimo elemento
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator cend() const;
+
  private:
     class Node {
      public:
-        explicit Node(const T& data): data_{data} {}
-
-        Node(const T& data, Node* next): data_{data}, next_{next} {}
-
-        Node(const T& data, Node* prev, Node* next):
-            data_{data}, prev_{prev}, next_{next} {}
+        template<typename... Args>
+        Node(std::in_place_t, Node* prev, Node* next, Args&&... args):
+            data_(std::forward<Args>(args)...),
+            prev_{prev},
+            next_{next}
+        {}
 
         T& data() { return data_; }
 
@@ -160,62 +292,165 @@ class DoublyCircularList {
         Node* next_{nullptr};
     };
 
-    Node* nodeAt(std::size_t index) {
+    Node* nodeAt(std::size_t index) const {
         if (index >= size_)
             throw std::out_of_range("INDEX OUT OF BOUNDS AT");
-        auto it = head;
-        for (auto i = 0u; i < index; ++i) {
-            it = it->next();
+        if (index < size_ / 2) {
+            auto it = head;
+            for (auto i = 0u; i < index; ++i) {
+                it = it->next();
+            }
+            return it;
+        }
+        auto it = head->prev();
+        for (auto i = size_ - 1; i > index; --i) {
+            it = it->prev();
         }
         return it;
     }
 
+    Node* last() const { return empty() ? nullptr : head->prev(); }
+
+    typename Alloc::template rebind<Node> alloc_;
     Node* head{nullptr};
     std::size_t size_{0u};
 };
 
-    template<typename T>
-    DoublyCircularList<T>::~DoublyCircularList() { clear(); }
+    template<typename T, typename Alloc>
+    DoublyCircularList<T, Alloc>::DoublyCircularList(
+        const DoublyCircularList& other) :
+        alloc_{other.alloc_}
+    {
+        try {
+            for (auto& data : other)
+                push_back(data);
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    template<typename T, typename Alloc>
+    DoublyCircularList<T, Alloc>::DoublyCircularList(
+        DoublyCircularList&& other) noexcept :
+        alloc_{std::move(other.alloc_)},
+        head{std::exchange(other.head, nullptr)},
+        size_{std::exchange(other.size_, 0u)}
+    {}
+
+    template<typename T, typename Alloc>
+    DoublyCircularList<T, Alloc>& DoublyCircularList<T, Alloc>::operator=(
+        const DoublyCircularList& other) {
+        if (this != &other) {
+            DoublyCircularList copy{other};
+            swap(copy);
+        }
+        return *this;
+    }
 
-    template<typename T>
-    void DoublyCircularList<T>::clear() {
+    template<typename T, typename Alloc>
+    DoublyCircularList<T, Alloc>& DoublyCircularList<T, Alloc>::operator=(
+        DoublyCircularList&& other) noexcept {
+        if (this != &other) {
+            DoublyCircularList moved{std::move(other)};
+            swap(moved);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Alloc>
+    DoublyCircularList<T, Alloc>::~DoublyCircularList() { clear(); }
+
+    template<typename T, typename Alloc>
+    void DoublyCircularList<T, Alloc>::swap(
+        DoublyCircularList& other) noexcept {
+        std::swap(alloc_, other.alloc_);
+        std::swap(head, other.head);
+        std::swap(size_, other.size_);
+    }
+
+    template<typename T, typename Alloc>
+    void DoublyCircularList<T, Alloc>::clear() {
         while (!empty()) {
             pop_front();
         }
     }
 
-    template<typename T>
-    void DoublyCircularList<T>::push_back(const T &data) {
-        insert(data, size());
+    template<typename T, typename Alloc>
+    void DoublyCircularList<T, Alloc>::push_back(const T &data) {
+        emplace_back(data);
+    }
+
+    template<typename T, typename Alloc>
+    void DoublyCircularList<T, Alloc>::push_back(T&& data) {
+        emplace_back(std::move(data));
     }
 
-    template<typename T>
-    void DoublyCircularList<T>::push_front(const T &data) {
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    T& DoublyCircularList<T, Alloc>::emplace_back(Args&&... args) {
+        auto& data = emplace_front(std::forward<Args>(args)...);
+        head = head->next();
+        return data;
+    }
+
+    template<typename T, typename Alloc>
+    void DoublyCircularList<T, Alloc>::push_front(const T &data) {
+        emplace_front(data);
+    }
+
+    template<typename T, typename Alloc>
+    void DoublyCircularList<T, Alloc>::push_front(T&& data) {
+        emplace_front(std::move(data));
+    }
+
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    T& DoublyCircularList<T, Alloc>::emplace_front(Args&&... args) {
         if (empty()) {
-            head = new Node(data);
+            head = alloc_.create(std::in_place, nullptr, nullptr,
+                                 std::forward<Args>(args)...);
             head->next(head);
             head->prev(head);
         } else {
-            head = new Node(data, head->prev(), head);
+            head = alloc_.create(std::in_place, head->prev(), head,
+                                 std::forward<Args>(args)...);
             head->prev()->next(head);
             head->next()->prev(head);
         }
         ++size_;
+        return head->data();
     }
 
-    template<typename T>
-    void DoublyCircularList<T>::insert(const T &data, std::size_t index) {
+    template<typename T, typename Alloc>
+    void DoublyCircularList<T, Alloc>::insert(const T &data, std::size_t index) {
+        emplace(index, data);
+    }
+
+    template<typename T, typename Alloc>
+    void DoublyCircularList<T, Alloc>::insert(T&& data, std::size_t index) {
+        emplace(index, std::move(data));
+    }
+
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    T& DoublyCircularList<T, Alloc>::emplace(std::size_t index,
+                                             Args&&... args) {
         if (index == 0)
-            return push_front(data);
+            return emplace_front(std::forward<Args>(args)...);
+        if (index == size_)
+            return emplace_back(std::forward<Args>(args)...);
         auto it = nodeAt(index - 1);
-        auto new_node = new Node(data, it, it->next());
+        auto new_node = alloc_.create(std::in_place, it, it->next(),
+                                      std::forward<Args>(args)...);
         it->next()->prev(new_node);
         it->next(new_node);
         ++size_;
+        return new_node->data();
     }
 
-    template<typename T>
-    void DoublyCircularList<T>::insert_sorted(const T &data) {
+    template<typename T, typename Alloc>
+    void DoublyCircularList<T, Alloc>::insert_sorted(const T &data) {
         if (empty() || data <= head->data()) {
             return push_front(data);
         }
@@ -224,14 +459,14 @@ class DoublyCircularList {
             if (data < it->next()->data())
                 break;
         }
-        auto new_node = new Node(data, it, it->next());
+        auto new_node = alloc_.create(std::in_place, it, it->next(), data);
         it->next()->prev(new_node);
         it->next(new_node);
         ++size_;
     }
 
-    template<typename T>
-    T DoublyCircularList<T>::pop(std::size_t index) {
+    template<typename T, typename Alloc>
+    T DoublyCircularList<T, Alloc>::pop(std::size_t index) {
         if (index >= size_)
             throw std::out_of_range("INDEX OUT OF BOUNDS");
         if (index == 0)
@@ -241,53 +476,59 @@ class DoublyCircularList {
         to_delete->next()->prev(to_delete->prev());
         to_delete->prev()->next(to_delete->next());
         --size_;
-        delete to_delete;
+        alloc_.destroy(to_delete);
         return data;
     }
 
-    template<typename T>
-    T DoublyCircularList<T>::pop_back() { return pop(size() - 1); }
+    template<typename T, typename Alloc>
+    T DoublyCircularList<T, Alloc>::pop_back() {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        return pop(size() - 1);
+    }
 
-    template<typename T>
-    T DoublyCircularList<T>::pop_front() {
+    template<typename T, typename Alloc>
+    T DoublyCircularList<T, Alloc>::pop_front() {
         if (empty())
             throw std::out_of_range("EMPTY");
         auto to_delete = head;
         auto data = std::move(to_delete->data());
-        head = to_delete->next();
+        if (size_ == 1) {
+            head = nullptr;
+        } else {
+            to_delete->next()->prev(to_delete->prev());
+            to_delete->prev()->next(to_delete->next());
+            head = to_delete->next();
+        }
         --size_;
-        delete to_delete;
+        alloc_.destroy(to_delete);
         return data;
     }
 
-    template<typename T>
-    void DoublyCircularList<T>::remove(const T &data) {
-        auto to_remove = nodeAt(find(data));
-        to_remove->next()->prev(to_remove->prev());
-        to_remove->prev()->next(to_remove->next());
-        delete to_remove;
-        --size_;
+    template<typename T, typename Alloc>
+    void DoublyCircularList<T, Alloc>::remove(const T &data) {
+        pop(find(data));
     }
 
-    template<typename T>
-    bool DoublyCircularList<T>::empty() const { return size() == 0u; }
+    template<typename T, typename Alloc>
+    bool DoublyCircularList<T, Alloc>::empty() const { return size() == 0u; }
 
-    template<typename T>
-    bool DoublyCircularList<T>::contains(const T &data) const {
+    template<typename T, typename Alloc>
+    bool DoublyCircularList<T, Alloc>::contains(const T &data) const {
         return find(data) != size();
     }
 
-    template<typename T>
-    T &DoublyCircularList<T>::at(std::size_t index) {
+    template<typename T, typename Alloc>
+    T &DoublyCircularList<T, Alloc>::at(std::size_t index) {
         return nodeAt(index)->data(); }
 
-    template<typename T>
-    const T &DoublyCircularList<T>::at(std::size_t index) const {
+    template<typename T, typename Alloc>
+    const T &DoublyCircularList<T, Alloc>::at(std::size_t index) const {
         return nodeAt(index)->data();
     }
 
-    template<typename T>
-    std::size_t DoublyCircularList<T>::find(const T &data) const {
+    template<typename T, typename Alloc>
+    std::size_t DoublyCircularList<T, Alloc>::find(const T &data) const {
         auto it = head;
         std::size_t index = 0u;
         while (it != nullptr && it->data() != data && index < size()) {
@@ -299,8 +540,44 @@ class DoublyCircularList {
         return index;
     }
 
-    template<typename T>
-    std::size_t DoublyCircularList<T>::size() const { return size_; }
+    template<typename T, typename Alloc>
+    std::size_t DoublyCircularList<T, Alloc>::size() const { return size_; }
+
+    template<typename T, typename Alloc>
+    typename DoublyCircularList<T, Alloc>::iterator
+    DoublyCircularList<T, Alloc>::begin() {
+        return iterator{head, last(), 0u};
+    }
+
+    template<typename T, typename Alloc>
+    typename DoublyCircularList<T, Alloc>::const_iterator
+    DoublyCircularList<T, Alloc>::begin() const {
+        return const_iterator{head, last(), 0u};
+    }
+
+    template<typename T, typename Alloc>
+    typename DoublyCircularList<T, Alloc>::const_iterator
+    DoublyCircularList<T, Alloc>::cbegin() const {
+        return begin();
+    }
+
+    template<typename T, typename Alloc>
+    typename DoublyCircularList<T, Alloc>::iterator
+    DoublyCircularList<T, Alloc>::end() {
+        return iterator{nullptr, last(), size_};
+    }
+
+    template<typename T, typename Alloc>
+    typename DoublyCircularList<T, Alloc>::const_iterator
+    DoublyCircularList<T, Alloc>::end() const {
+        return const_iterator{nullptr, last(), size_};
+    }
+
+    template<typename T, typename Alloc>
+    typename DoublyCircularList<T, Alloc>::const_iterator
+    DoublyCircularList<T, Alloc>::cend() const {
+        return end();
+    }
 
 }  // namespace structures
 
@@ -5,20 +5,60 @@
 
 #include <stdexcept>
 #include <cstdint>
+#include <utility>
+
+#include "../node_iterator/node_iterator.h"
+#include "../node_pool/node_pool.h"
 
 namespace structures {
 
 /*!
  * \brief A classe DoublyLinkedList implementa uma lista duplamente encadeada 
  */
-template<typename T>
+template<typename T, typename Alloc = HeapAllocator>
 class DoublyLinkedList {
+    class Node;
+
  public:
+    using value_type = T;
+    using iterator = BidirectionalNodeIterator<T, Node>;
+    using const_iterator = BidirectionalNodeIterator<const T, const Node>;
+
+    /*!
+     * \brief Construtor da lista vazia
+     */
+    DoublyLinkedList() = default;
+
+    /*!
+     * \brief Construtor de copia, copia todos os elementos de other
+     */
+    DoublyLinkedList(const DoublyLinkedList& other);
+
+    /*!
+     * \brief Construtor de movimento, assume os Nodes de other sem alocar
+     */
+    DoublyLinkedList(DoublyLinkedList&& other) noexcept;
+
+    /*!
+     * \brief Atribuicao por copia
+     */
+    DoublyLinkedList& operator=(const DoublyLinkedList& other);
+
+    /*!
+     * \brief Atribuicao por movimento
+     */
+    DoublyLinkedList& operator=(DoublyLinkedList&& other) noexcept;
+
     /*!
      * \brief Destrutor
      */
     ~DoublyLinkedList();
 
+    /*!
+     * \brief Troca o conteudo com outra lista em O(1)
+     */
+    void swap(DoublyLinkedList& other) noexcept;
+
     /*!
      * \brief Remove todos os elementos da lista
      */
@@ -29,16 +69,55 @@ class DoublyLinkedList {
      */
     void push_back(const T& data);
 
+    /*!
+     * \brief Insere um dado ao final da lista, movendo o dado
+     */
+    void push_back(T&& data);
+
+    /*!
+     * \brief Constroi um dado ao final da lista a partir de args
+     *
+     * \return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace_back(Args&&... args);
+
     /*!
      * \brief Insere um dado no inicio da lista
      */
     void push_front(const T& data);
 
+    /*!
+     * \brief Insere um dado no inicio da lista, movendo o dado
+     */
+    void push_front(T&& data);
+
+    /*!
+     * \brief Constroi um dado no inicio da lista a partir de args
+     *
+     * \return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace_front(Args&&... args);
+
     /*!
      * \brief Insere um dado num determinado index
      */
     void insert(const T& data, std::size_t index);
 
+    /*!
+     * \brief Insere um dado num determinado index, movendo o dado
+     */
+    void insert(T&& data, std::size_t index);
+
+    /*!
+     * \brief Constroi um dado num determinado index a partir de args
+     *
+     * \return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace(std::size_t index, Args&&... args);
+
     /*!
      * \brief Insere numa ordem especifica
      */
@@ -124,15 +203,57 @@ class DoublyLinkedList {
      */
     std::size_t size() const;
 
+    /*!
+     * \brief Iterador para o primeiro elemento
+     *
+     * \return iterador para o primeiro elemento
+     */
+    iterator begin();
+
+    /*!
+     * \brief Iterador constante para o primeiro elemento
+     *
+     * \return iterador constante para o primeiro elemento
+     */
+    const_iterator begin() const;
+
+    /*!
+     * \brief Iterador constante para o primeiro elemento
+     *
+     * \return iterador constante para o primeiro elemento
+     */
+    const_iterator cbegin() const;
+
+    /*!
+     * \brief Iterador para depois do ultimo elemento
+     *
+     * \return iterador para o fim
+     */
+    iterator end();
+
+    /*!
+     * \brief Iterador constante para depois do ultimo elemento
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator end() const;
+
+    /*!
+     * \brief Iterador constante para depois do ultimo elemento
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator cend() const;
+
  private:
     class Node {
      public:
-        explicit Node(const T& data): data_{data} {}
-
-        Node(const T& data, Node* next): data_{data}, next_{next} {}
-
-        Node(const T& data, Node* prev, Node* next):
-            data_{data}, prev_{prev}, next_{next} {}
+        template<typename... Args>
+        Node(std::in_place_t, Node* prev, Node* next, Args&&... args):
+            data_(std::forward<Args>(args)...),
+            prev_{prev},
+            next_{next}
+        {}
 
         T& data() { return data_; }
 
@@ -156,131 +277,250 @@ class DoublyLinkedList {
         Node* next_{nullptr};
     };
 
-    Node* nodeAt(std::size_t index) {
+    Node* nodeAt(std::size_t index) const {
         if (index >= size_)
             throw std::out_of_range("INDEX OUT OF BOUNDS AT");
-        auto it = head;
-        for (auto i = 0u; i < index; ++i) {
-            it = it->next();
+        if (index < size_ / 2) {
+            auto it = head;
+            for (auto i = 0u; i < index; ++i) {
+                it = it->next();
+            }
+            return it;
+        }
+        auto it = tail;
+        for (auto i = size_ - 1; i > index; --i) {
+            it = it->prev();
         }
         return it;
     }
 
+    typename Alloc::template rebind<Node> alloc_;
     Node* head{nullptr};
+    Node* tail{nullptr};
     std::size_t size_{0u};
 };
 
-    template<typename T>
-    DoublyLinkedList<T>::~DoublyLinkedList() { clear(); }
+    template<typename T, typename Alloc>
+    DoublyLinkedList<T, Alloc>::DoublyLinkedList(
+        const DoublyLinkedList& other) :
+        alloc_{other.alloc_}
+    {
+        try {
+            for (auto& data : other)
+                push_back(data);
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    template<typename T, typename Alloc>
+    DoublyLinkedList<T, Alloc>::DoublyLinkedList(
+        DoublyLinkedList&& other) noexcept :
+        alloc_{std::move(other.alloc_)},
+        head{std::exchange(other.head, nullptr)},
+        tail{std::exchange(other.tail, nullptr)},
+        size_{std::exchange(other.size_, 0u)}
+    {}
+
+    template<typename T, typename Alloc>
+    DoublyLinkedList<T, Alloc>& DoublyLinkedList<T, Alloc>::operator=(
+        const DoublyLinkedList& other) {
+        if (this != &other) {
+            DoublyLinkedList copy{other};
+            swap(copy);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Alloc>
+    DoublyLinkedList<T, Alloc>& DoublyLinkedList<T, Alloc>::operator=(
+        DoublyLinkedList&& other) noexcept {
+        if (this != &other) {
+            DoublyLinkedList moved{std::move(other)};
+            swap(moved);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Alloc>
+    DoublyLinkedList<T, Alloc>::~DoublyLinkedList() { clear(); }
+
+    template<typename T, typename Alloc>
+    void DoublyLinkedList<T, Alloc>::swap(DoublyLinkedList& other) noexcept {
+        std::swap(alloc_, other.alloc_);
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(size_, other.size_);
+    }
 
-    template<typename T>
-    void DoublyLinkedList<T>::clear() {
+    template<typename T, typename Alloc>
+    void DoublyLinkedList<T, Alloc>::clear() {
         while (!empty()) {
             pop_front();
         }
     }
 
-    template<typename T>
-    void DoublyLinkedList<T>::push_back(const T& data) {
-        return insert(data, size());
+    template<typename T, typename Alloc>
+    void DoublyLinkedList<T, Alloc>::push_back(const T& data) {
+        emplace_back(data);
+    }
+
+    template<typename T, typename Alloc>
+    void DoublyLinkedList<T, Alloc>::push_back(T&& data) {
+        emplace_back(std::move(data));
+    }
+
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    T& DoublyLinkedList<T, Alloc>::emplace_back(Args&&... args) {
+        if (empty())
+            return emplace_front(std::forward<Args>(args)...);
+        auto new_node = alloc_.create(std::in_place, tail, nullptr,
+                                      std::forward<Args>(args)...);
+        tail->next(new_node);
+        tail = new_node;
+        ++size_;
+        return new_node->data();
+    }
+
+    template<typename T, typename Alloc>
+    void DoublyLinkedList<T, Alloc>::push_front(const T& data) {
+        emplace_front(data);
     }
 
-    template<typename T>
-    void DoublyLinkedList<T>::push_front(const T& data) {
-        head = new Node(data, head);
+    template<typename T, typename Alloc>
+    void DoublyLinkedList<T, Alloc>::push_front(T&& data) {
+        emplace_front(std::move(data));
+    }
+
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    T& DoublyLinkedList<T, Alloc>::emplace_front(Args&&... args) {
+        head = alloc_.create(std::in_place, nullptr, head,
+                             std::forward<Args>(args)...);
         if (head->next() != nullptr)
             head->next()->prev(head);
+        else
+            tail = head;
         ++size_;
+        return head->data();
+    }
+
+    template<typename T, typename Alloc>
+    void DoublyLinkedList<T, Alloc>::insert(const T& data, std::size_t index) {
+        emplace(index, data);
     }
 
-    template<typename T>
-    void DoublyLinkedList<T>::insert(const T& data, std::size_t index) {
+    template<typename T, typename Alloc>
+    void DoublyLinkedList<T, Alloc>::insert(T&& data, std::size_t index) {
+        emplace(index, std::move(data));
+    }
+
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    T& DoublyLinkedList<T, Alloc>::emplace(std::size_t index, Args&&... args) {
         if (index == 0)
-            return push_front(data);
+            return emplace_front(std::forward<Args>(args)...);
+        if (index == size_)
+            return emplace_back(std::forward<Args>(args)...);
         auto it = nodeAt(index-1);
-        auto new_node = new Node(data, it, it->next());
-        if (it->next() != nullptr)
-            it->next()->prev(new_node);
+        auto new_node = alloc_.create(std::in_place, it, it->next(),
+                                      std::forward<Args>(args)...);
+        it->next()->prev(new_node);
         it->next(new_node);
         ++size_;
+        return new_node->data();
     }
 
-    template<typename T>
-    void DoublyLinkedList<T>::insert_sorted(const T& data) {
+    template<typename T, typename Alloc>
+    void DoublyLinkedList<T, Alloc>::insert_sorted(const T& data) {
         if (empty() || data <= head->data())
             return push_front(data);
         auto it = head;
         while (it->next() != nullptr && data > it->next()->data()) {
             it = it->next();
         }
-        auto new_node = new Node(data, it, it->next());
+        auto new_node = alloc_.create(std::in_place, it, it->next(), data);
         if (it->next() != nullptr)
             it->next()->prev(new_node);
+        else
+            tail = new_node;
         it->next(new_node);
         ++size_;
     }
 
-    template<typename T>
-    T DoublyLinkedList<T>::pop(std::size_t index) {
+    template<typename T, typename Alloc>
+    T DoublyLinkedList<T, Alloc>::pop(std::size_t index) {
         if (index == 0)
             return pop_front();
+        if (index == size_ - 1)
+            return pop_back();
         auto to_delete = nodeAt(index);
         auto data = std::move(to_delete->data());
-        if (to_delete->next() != nullptr)
-            to_delete->next()->prev(to_delete->prev());
+        to_delete->next()->prev(to_delete->prev());
         to_delete->prev()->next(to_delete->next());
-        delete to_delete;
+        alloc_.destroy(to_delete);
         --size_;
         return data;
     }
 
-    template<typename T>
-    T DoublyLinkedList<T>::pop_back() { return pop(size()-1); }
+    template<typename T, typename Alloc>
+    T DoublyLinkedList<T, Alloc>::pop_back() {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        if (size_ == 1)
+            return pop_front();
+        auto to_delete = tail;
+        auto data = std::move(to_delete->data());
+        tail = to_delete->prev();
+        tail->next(nullptr);
+        --size_;
+        alloc_.destroy(to_delete);
+        return data;
+    }
 
-    template<typename T>
-    T DoublyLinkedList<T>::pop_front() {
+    template<typename T, typename Alloc>
+    T DoublyLinkedList<T, Alloc>::pop_front() {
         if (empty())
             throw std::out_of_range("EMPTY");
         auto to_delete = head;
         auto data = std::move(to_delete->data());
         head = to_delete->next();
         if (head != nullptr)
-            head->prev(to_delete->prev());
+            head->prev(nullptr);
+        else
+            tail = nullptr;
         --size_;
-        delete to_delete;
+        alloc_.destroy(to_delete);
         return data;
     }
 
-    template<typename T>
-    void DoublyLinkedList<T>::remove(const T& data) {
-        auto to_remove = nodeAt(find(data));
-        if (to_remove->next() != nullptr)
-            to_remove->next()->prev(to_remove->prev());
-        to_remove->prev()->next(to_remove->next());
-        delete to_remove;
-        --size_;
+    template<typename T, typename Alloc>
+    void DoublyLinkedList<T, Alloc>::remove(const T& data) {
+        pop(find(data));
     }
 
-    template<typename T>
-    bool DoublyLinkedList<T>::empty() const { return size() == 0u; }
+    template<typename T, typename Alloc>
+    bool DoublyLinkedList<T, Alloc>::empty() const { return size() == 0u; }
 
-    template<typename T>
-    bool DoublyLinkedList<T>::contains(const T& data) const {
+    template<typename T, typename Alloc>
+    bool DoublyLinkedList<T, Alloc>::contains(const T& data) const {
         return find(data) != size();
     }
 
-    template<typename T>
-    T& DoublyLinkedList<T>::at(std::size_t index) {
+    template<typename T, typename Alloc>
+    T& DoublyLinkedList<T, Alloc>::at(std::size_t index) {
         return nodeAt(index)->data();
     }
 
-    template<typename T>
-    const T& DoublyLinkedList<T>::at(std::size_t index) const {
+    template<typename T, typename Alloc>
+    const T& DoublyLinkedList<T, Alloc>::at(std::size_t index) const {
         return nodeAt(index)->data();
     }
 
-    template<typename T>
-    std::size_t DoublyLinkedList<T>::find(const T& data) const {
+    template<typename T, typename Alloc>
+    std::size_t DoublyLinkedList<T, Alloc>::find(const T& data) const {
         auto it = head;
         std::size_t index = 0u;
         while (it != nullptr && it->data() != data) {
@@ -290,8 +530,44 @@ class DoublyLinkedList {
         return index;
     }
 
-    template<typename T>
-    std::size_t DoublyLinkedList<T>::size() const { return size_;}
+    template<typename T, typename Alloc>
+    std::size_t DoublyLinkedList<T, Alloc>::size() const { return size_;}
+
+    template<typename T, typename Alloc>
+    typename DoublyLinkedList<T, Alloc>::iterator
+    DoublyLinkedList<T, Alloc>::begin() {
+        return iterator{head, tail, 0u};
+    }
+
+    template<typename T, typename Alloc>
+    typename DoublyLinkedList<T, Alloc>::const_iterator
+    DoublyLinkedList<T, Alloc>::begin() const {
+        return const_iterator{head, tail, 0u};
+    }
+
+    template<typename T, typename Alloc>
+    typename DoublyLinkedList<T, Alloc>::const_iterator
+    DoublyLinkedList<T, Alloc>::cbegin() const {
+        return begin();
+    }
+
+    template<typename T, typename Alloc>
+    typename DoublyLinkedList<T, Alloc>::iterator
+    DoublyLinkedList<T, Alloc>::end() {
+        return iterator{nullptr, tail, size_};
+    }
+
+    template<typename T, typename Alloc>
+    typename DoublyLinkedList<T, Alloc>::const_iterator
+    DoublyLinkedList<T, Alloc>::end() const {
+        return const_iterator{nullptr, tail, size_};
+    }
+
+    template<typename T, typename Alloc>
+    typename DoublyLinkedList<T, Alloc>::const_iterator
+    DoublyLinkedList<T, Alloc>::cend() const {
+        return end();
+    }
 
 }  // namespace structures
 
@@ -0,0 +1,238 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_HAZARD_POINTER_H
+#define STRUCTURES_HAZARD_POINTER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace structures {
+
+/*!
+ *  \brief HazardDomain implementa reclamacao de memoria por hazard pointers.
+ *
+ *  Uma thread publica num Record o ponteiro que vai acessar; um Node
+ *  removido de uma estrutura sem lock eh aposentado (retire) e so eh
+ *  liberado quando nenhum registro o aponta. Os registros formam uma lista
+ *  global que nunca encolhe; cada thread guarda os registros que ja usou
+ *  e so os devolve ao terminar, entao criar um HazardPointer nao percorre
+ *  a lista no caso comum. Cada thread acumula seus Nodes aposentados e faz
+ *  a varredura quando eles passam de um limite proporcional ao numero de
+ *  registros.
+ */
+class HazardDomain {
+ public:
+    struct Record {
+        std::atomic<const void*> pointer{nullptr};
+        std::atomic<bool> active{false};
+        Record* next{nullptr};
+    };
+
+    /*!
+     *  \brief Dominio global usado por todas as estruturas.
+     */
+    static HazardDomain& instance() {
+        static HazardDomain domain;
+        return domain;
+    }
+
+    /*!
+     *  \brief Reserva um registro para a thread atual.
+     */
+    Record* acquire();
+
+    /*!
+     *  \brief Devolve um registro para a thread atual.
+     */
+    void release(Record* record);
+
+    /*!
+     *  \brief Aposenta um ponteiro, que sera liberado com deleter quando nao
+     *  houver mais hazard pointers para ele.
+     */
+    void retire(void* pointer, void (*deleter)(void*));
+
+ private:
+    struct Retired {
+        void* pointer;
+        void (*deleter)(void*);
+    };
+
+    struct ThreadState {
+        ~ThreadState();
+
+        std::vector<Record*> records;
+        std::vector<Retired> retired;
+    };
+
+    HazardDomain() = default;
+
+    static ThreadState& thread_state() {
+        thread_local ThreadState state;
+        return state;
+    }
+
+    Record* acquire_global();
+
+    void scan(std::vector<Retired>& retired);
+
+    std::atomic<Record*> records_{nullptr};
+    std::atomic<std::size_t> record_count_{0u};
+
+    std::mutex orphans_mutex_;
+    std::vector<Retired> orphans_;
+
+    static constexpr std::size_t SCAN_FACTOR = 2u;
+    static constexpr std::size_t MIN_SCAN = 64u;
+};
+
+/*!
+ *  \brief HazardPointer eh o dono RAII de um registro do HazardDomain.
+ */
+class HazardPointer {
+ public:
+    HazardPointer(): record_{HazardDomain::instance().acquire()} {}
+
+    HazardPointer(const HazardPointer&) = delete;
+
+    HazardPointer& operator=(const HazardPointer&) = delete;
+
+    ~HazardPointer() {
+        reset();
+        HazardDomain::instance().release(record_);
+    }
+
+    /*!
+     *  \brief Le source e publica o valor lido ate que ele seja estavel.
+     *
+     *  \return ponteiro protegido (pode ser nullptr).
+     */
+    template<typename P>
+    P* protect(const std::atomic<P*>& source) {
+        auto pointer = source.load();
+        while (true) {
+            record_->pointer.store(pointer);
+            auto current = source.load();
+            if (current == pointer)
+                return pointer;
+            pointer = current;
+        }
+    }
+
+    /*!
+     *  \brief Publica pointer sem validar; quem chama valida depois.
+     */
+    void set(const void* pointer) { record_->pointer.store(pointer); }
+
+    /*!
+     *  \brief Deixa de proteger o ponteiro atual.
+     */
+    void reset() {
+        record_->pointer.store(nullptr, std::memory_order_release);
+    }
+
+ private:
+    HazardDomain::Record* record_;
+};
+
+/*!
+ *  \brief Aposenta um objeto alocado com new.
+ */
+template<typename T>
+void retire(T* pointer) {
+    HazardDomain::instance().retire(pointer, [](void* p) {
+        delete static_cast<T*>(p);
+    });
+}
+
+inline HazardDomain::Record* HazardDomain::acquire() {
+    auto& records = thread_state().records;
+    if (records.empty())
+        return acquire_global();
+    auto record = records.back();
+    records.pop_back();
+    return record;
+}
+
+inline void HazardDomain::release(Record* record) {
+    record->pointer.store(nullptr, std::memory_order_release);
+    thread_state().records.push_back(record);
+}
+
+inline HazardDomain::Record* HazardDomain::acquire_global() {
+    for (auto it = records_.load(std::memory_order_acquire); it != nullptr;
+         it = it->next) {
+        auto expected = false;
+        if (!it->active.load(std::memory_order_relaxed) &&
+            it->active.compare_exchange_strong(expected, true,
+                                               std::memory_order_acquire))
+            return it;
+    }
+    auto record = new Record();
+    record->active.store(true, std::memory_order_relaxed);
+    auto head = records_.load(std::memory_order_relaxed);
+    do {
+        record->next = head;
+    } while (!records_.compare_exchange_weak(head, record,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed));
+    record_count_.fetch_add(1u, std::memory_order_relaxed);
+    return record;
+}
+
+inline void HazardDomain::retire(void* pointer, void (*deleter)(void*)) {
+    auto& retired = thread_state().retired;
+    retired.push_back({pointer, deleter});
+    auto threshold = std::max(
+        MIN_SCAN,
+        SCAN_FACTOR * record_count_.load(std::memory_order_relaxed));
+    if (retired.size() >= threshold)
+        scan(retired);
+}
+
+inline void HazardDomain::scan(std::vector<Retired>& retired) {
+    {
+        std::lock_guard<std::mutex> lock(orphans_mutex_);
+        retired.insert(retired.end(), orphans_.begin(), orphans_.end());
+        orphans_.clear();
+    }
+
+    std::vector<const void*> hazards;
+    for (auto it = records_.load(std::memory_order_acquire); it != nullptr;
+         it = it->next) {
+        auto pointer = it->pointer.load();
+        if (pointer != nullptr)
+            hazards.push_back(pointer);
+    }
+    std::sort(hazards.begin(), hazards.end());
+
+    auto kept = retired.begin();
+    for (auto& node : retired) {
+        if (std::binary_search(hazards.begin(), hazards.end(), node.pointer))
+            *kept++ = node;
+        else
+            node.deleter(node.pointer);
+    }
+    retired.erase(kept, retired.end());
+}
+
+inline HazardDomain::ThreadState::~ThreadState() {
+    auto& domain = HazardDomain::instance();
+    for (auto record : records) {
+        record->active.store(false, std::memory_order_release);
+    }
+    domain.scan(retired);
+    if (!retired.empty()) {
+        std::lock_guard<std::mutex> lock(domain.orphans_mutex_);
+        domain.orphans_.insert(domain.orphans_.end(), retired.begin(),
+                               retired.end());
+    }
+}
+
+}  // namespace structures
+
+#endif
@@ -0,0 +1,40 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_INLINE_STORAGE_H
+#define STRUCTURES_INLINE_STORAGE_H
+
+#include <cstdint>
+
+namespace structures {
+
+/*!
+ *  \brief Espaco nao inicializado para N elementos dentro do proprio
+ *  objeto, usado pelos containers com capacidade inline.
+ *
+ *  Os containers herdam de InlineStorage para que, com N = 0, a base vazia
+ *  nao ocupe espaco.
+ */
+template<typename T, std::size_t N>
+class InlineStorage {
+ public:
+    T* inline_data() { return reinterpret_cast<T*>(storage_); }
+
+    const T* inline_data() const {
+        return reinterpret_cast<const T*>(storage_);
+    }
+
+ private:
+    alignas(T) unsigned char storage_[N * sizeof(T)];
+};
+
+template<typename T>
+class InlineStorage<T, 0u> {
+ public:
+    T* inline_data() { return nullptr; }
+
+    const T* inline_data() const { return nullptr; }
+};
+
+}  // namespace structures
+
+#endif
@@ -0,0 +1,107 @@
+// Copyright [2017] <Luiz Motta>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "../doubly_linked_list/doubly_linked_list.h"
+#include "intrusive_doubly_linked_list.h"
+
+/**
+ * Compara a DoublyLinkedList, que aloca um Node por insercao e precisa de
+ * find() para remover um elemento, com a lista intrusiva, que so liga os
+ * ganchos dos objetos.
+ */
+
+namespace {
+
+struct Connection : structures::IntrusiveListHook<> {
+    explicit Connection(int id): id{id} {}
+
+    int id;
+};
+
+/*!
+ * \brief Conexao aleatoria (xorshift64), em qualquer posicao da lista.
+ */
+int random_id(std::uint64_t& state, int n) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return static_cast<int>(state % static_cast<std::uint64_t>(n));
+}
+
+}  // namespace
+
+static void BM_DoublyLinkedListRemove(benchmark::State& state) {
+    auto n = static_cast<int>(state.range(0));
+    structures::DoublyLinkedList<int> list;
+    for (auto i = 0; i < n; ++i) {
+        list.push_back(i);
+    }
+    std::uint64_t seed = 0x9E3779B97F4A7C15u;
+    for (auto _ : state) {
+        // Tira uma conexao qualquer e a recoloca no final.
+        auto id = random_id(seed, n);
+        list.remove(id);
+        list.push_back(id);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_IntrusiveErase(benchmark::State& state) {
+    auto n = static_cast<int>(state.range(0));
+    std::vector<Connection> connections;
+    connections.reserve(n);
+    structures::IntrusiveDoublyLinkedList<Connection> list;
+    for (auto i = 0; i < n; ++i) {
+        connections.emplace_back(i);
+        list.push_back(connections.back());
+    }
+    std::uint64_t seed = 0x9E3779B97F4A7C15u;
+    for (auto _ : state) {
+        auto id = random_id(seed, n);
+        list.erase(connections[id]);
+        list.push_back(connections[id]);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_DoublyLinkedListPushPop(benchmark::State& state) {
+    auto n = static_cast<int>(state.range(0));
+    structures::DoublyLinkedList<int> list;
+    for (auto _ : state) {
+        for (auto i = 0; i < n; ++i) {
+            list.push_back(i);
+        }
+        while (!list.empty()) {
+            benchmark::DoNotOptimize(list.pop_front());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n * 2);
+}
+
+static void BM_IntrusivePushPop(benchmark::State& state) {
+    auto n = static_cast<int>(state.range(0));
+    std::vector<Connection> connections;
+    connections.reserve(n);
+    for (auto i = 0; i < n; ++i) {
+        connections.emplace_back(i);
+    }
+    structures::IntrusiveDoublyLinkedList<Connection> list;
+    for (auto _ : state) {
+        for (auto& connection : connections) {
+            list.push_back(connection);
+        }
+        while (!list.empty()) {
+            benchmark::DoNotOptimize(list.pop_front().id);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n * 2);
+}
+
+BENCHMARK(BM_DoublyLinkedListRemove)->Range(1 << 6, 1 << 14);
+BENCHMARK(BM_IntrusiveErase)->Range(1 << 6, 1 << 14);
+BENCHMARK(BM_DoublyLinkedListPushPop)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_IntrusivePushPop)->Range(1 << 10, 1 << 16);
+
+BENCHMARK_MAIN();
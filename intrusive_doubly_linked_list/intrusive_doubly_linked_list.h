@@ -0,0 +1,501 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_INTRUSIVE_DOUBLY_LINKED_LIST_H
+#define STRUCTURES_INTRUSIVE_DOUBLY_LINKED_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+namespace structures {
+
+template<typename T, typename Tag>
+class IntrusiveDoublyLinkedList;
+
+/*!
+ * \brief Gancho (prev/next) que um tipo herda publicamente para ser ligado
+ * numa IntrusiveDoublyLinkedList ou IntrusiveLinkedQueue com a mesma Tag.
+ *
+ * Herdando um gancho por Tag o objeto pode estar em varias listas ao mesmo
+ * tempo. Copiar o objeto nao copia as ligacoes: a copia comeca fora de
+ * qualquer lista. O objeto deve sair da lista antes de ser destruido.
+ */
+template<typename Tag = void>
+class IntrusiveListHook {
+ public:
+    IntrusiveListHook() = default;
+
+    IntrusiveListHook(const IntrusiveListHook&) {}
+
+    IntrusiveListHook& operator=(const IntrusiveListHook&) { return *this; }
+
+    /*!
+     * \brief Verifica se o objeto esta ligado em alguma lista desta Tag
+     *
+     * \return true caso esteja ligado
+     */
+    bool is_linked() const { return next_ != nullptr; }
+
+ private:
+    template<typename, typename> friend class IntrusiveDoublyLinkedList;
+
+    IntrusiveListHook* prev_{nullptr};
+    IntrusiveListHook* next_{nullptr};
+};
+
+/*!
+ * \brief Lista duplamente encadeada intrusiva: guarda referencias para
+ * objetos que herdam IntrusiveListHook<Tag>.
+ *
+ * A lista nao aloca nem copia nada, so liga e desliga os ganchos dos
+ * objetos, que continuam pertencendo a quem os criou. Como o objeto sabe
+ * onde esta, erase(obj) eh O(1), sem a busca que remove() faz na
+ * DoublyLinkedList. A lista eh um anel com um gancho sentinela, entao
+ * inserir e retirar nao tem casos especiais para as pontas.
+ */
+template<typename T, typename Tag = void>
+class IntrusiveDoublyLinkedList {
+    using Hook = IntrusiveListHook<Tag>;
+
+ public:
+    /*!
+     * \brief Iterador bidirecional sobre os objetos da lista.
+     *
+     * U eh T ou const T e H eh Hook ou const Hook.
+     */
+    template<typename U, typename H>
+    class Iterator {
+     public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = U*;
+        using reference = U&;
+
+        Iterator() = default;
+
+        explicit Iterator(H* hook): hook_{hook} {}
+
+        template<typename V, typename G, typename = typename std::enable_if<
+            std::is_convertible<G*, H*>::value>::type>
+        Iterator(const Iterator<V, G>& other):  // NOLINT
+            hook_{other.hook_} {}
+
+        reference operator*() const { return static_cast<reference>(*hook_); }
+
+        pointer operator->() const { return &**this; }
+
+        Iterator& operator++() {
+            hook_ = hook_->next_;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto old = *this;
+            ++*this;
+            return old;
+        }
+
+        Iterator& operator--() {
+            hook_ = hook_->prev_;
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            auto old = *this;
+            --*this;
+            return old;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return hook_ == other.hook_;
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return hook_ != other.hook_;
+        }
+
+     private:
+        template<typename, typename> friend class Iterator;
+
+        H* hook_{nullptr};
+    };
+
+    using value_type = T;
+    using iterator = Iterator<T, Hook>;
+    using const_iterator = Iterator<const T, const Hook>;
+
+    /*!
+     * \brief Construtor da lista vazia
+     */
+    IntrusiveDoublyLinkedList();
+
+    IntrusiveDoublyLinkedList(const IntrusiveDoublyLinkedList&) = delete;
+
+    IntrusiveDoublyLinkedList& operator=(const IntrusiveDoublyLinkedList&) =
+        delete;
+
+    /*!
+     * \brief Construtor de movimento, assume os objetos de other
+     */
+    IntrusiveDoublyLinkedList(IntrusiveDoublyLinkedList&& other) noexcept;
+
+    /*!
+     * \brief Desliga os objetos atuais e assume os de other
+     */
+    IntrusiveDoublyLinkedList& operator=(
+        IntrusiveDoublyLinkedList&& other) noexcept;
+
+    /*!
+     * \brief Destrutor, desliga todos os objetos
+     */
+    ~IntrusiveDoublyLinkedList();
+
+    /*!
+     * \brief Desliga todos os objetos da lista
+     */
+    void clear();
+
+    /*!
+     * \brief Liga um objeto no final da lista
+     *
+     * \param obj objeto que nao esta em nenhuma lista desta Tag
+     */
+    void push_back(T& obj);
+
+    /*!
+     * \brief Liga um objeto no inicio da lista
+     *
+     * \param obj objeto que nao esta em nenhuma lista desta Tag
+     */
+    void push_front(T& obj);
+
+    /*!
+     * \brief Liga um objeto antes de outro, em O(1)
+     *
+     * \param position objeto desta lista
+     * \param obj objeto que nao esta em nenhuma lista desta Tag
+     */
+    void insert(T& position, T& obj);
+
+    /*!
+     * \brief Desliga o ultimo objeto
+     *
+     * \return referencia do objeto desligado
+     */
+    T& pop_back();
+
+    /*!
+     * \brief Desliga o primeiro objeto
+     *
+     * \return referencia do objeto desligado
+     */
+    T& pop_front();
+
+    /*!
+     * \brief Desliga um objeto desta lista em O(1)
+     *
+     * \param obj objeto ligado nesta lista
+     */
+    void erase(T& obj);
+
+    /*!
+     * \brief Acessa o primeiro objeto
+     *
+     * \return referencia do primeiro objeto
+     */
+    T& front();
+
+    /*!
+     * \brief Acessa o primeiro objeto
+     *
+     * \return referencia constante do primeiro objeto
+     */
+    const T& front() const;
+
+    /*!
+     * \brief Acessa o ultimo objeto
+     *
+     * \return referencia do ultimo objeto
+     */
+    T& back();
+
+    /*!
+     * \brief Acessa o ultimo objeto
+     *
+     * \return referencia constante do ultimo objeto
+     */
+    const T& back() const;
+
+    /*!
+     * \brief Verifica se a lista esta vazia
+     *
+     * \return true caso a lista esteja vazia
+     */
+    bool empty() const;
+
+    /*!
+     * \brief Passa a quantidade de objetos ligados
+     *
+     * \return tamanho da lista
+     */
+    std::size_t size() const;
+
+    /*!
+     * \brief Iterador para o primeiro objeto
+     *
+     * \return iterador para o primeiro objeto
+     */
+    iterator begin();
+
+    /*!
+     * \brief Iterador constante para o primeiro objeto
+     *
+     * \return iterador constante para o primeiro objeto
+     */
+    const_iterator begin() const;
+
+    /*!
+     * \brief Iterador constante para o primeiro objeto
+     *
+     * \return iterador constante para o primeiro objeto
+     */
+    const_iterator cbegin() const;
+
+    /*!
+     * \brief Iterador para depois do ultimo objeto
+     *
+     * \return iterador para o fim
+     */
+    iterator end();
+
+    /*!
+     * \brief Iterador constante para depois do ultimo objeto
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator end() const;
+
+    /*!
+     * \brief Iterador constante para depois do ultimo objeto
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator cend() const;
+
+ private:
+    static Hook* hook(T& obj) { return static_cast<Hook*>(&obj); }
+
+    static T& owner(Hook* hook) { return static_cast<T&>(*hook); }
+
+    void link_before(Hook* position, Hook* node);
+
+    void unlink(Hook* node);
+
+    void take(IntrusiveDoublyLinkedList& other);
+
+    Hook root_;
+    std::size_t size_{0u};
+};
+
+    template<typename T, typename Tag>
+    IntrusiveDoublyLinkedList<T, Tag>::IntrusiveDoublyLinkedList() {
+        root_.prev_ = &root_;
+        root_.next_ = &root_;
+    }
+
+    template<typename T, typename Tag>
+    IntrusiveDoublyLinkedList<T, Tag>::IntrusiveDoublyLinkedList(
+        IntrusiveDoublyLinkedList&& other) noexcept :
+        IntrusiveDoublyLinkedList()
+    {
+        take(other);
+    }
+
+    template<typename T, typename Tag>
+    IntrusiveDoublyLinkedList<T, Tag>&
+    IntrusiveDoublyLinkedList<T, Tag>::operator=(
+        IntrusiveDoublyLinkedList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            take(other);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Tag>
+    IntrusiveDoublyLinkedList<T, Tag>::~IntrusiveDoublyLinkedList() {
+        clear();
+    }
+
+    template<typename T, typename Tag>
+    void IntrusiveDoublyLinkedList<T, Tag>::clear() {
+        auto it = root_.next_;
+        while (it != &root_) {
+            auto next = it->next_;
+            it->prev_ = nullptr;
+            it->next_ = nullptr;
+            it = next;
+        }
+        root_.prev_ = &root_;
+        root_.next_ = &root_;
+        size_ = 0u;
+    }
+
+    template<typename T, typename Tag>
+    void IntrusiveDoublyLinkedList<T, Tag>::push_back(T& obj) {
+        link_before(&root_, hook(obj));
+    }
+
+    template<typename T, typename Tag>
+    void IntrusiveDoublyLinkedList<T, Tag>::push_front(T& obj) {
+        link_before(root_.next_, hook(obj));
+    }
+
+    template<typename T, typename Tag>
+    void IntrusiveDoublyLinkedList<T, Tag>::insert(T& position, T& obj) {
+        if (!hook(position)->is_linked())
+            throw std::out_of_range("NOT LINKED");
+        link_before(hook(position), hook(obj));
+    }
+
+    template<typename T, typename Tag>
+    T& IntrusiveDoublyLinkedList<T, Tag>::pop_back() {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        auto node = root_.prev_;
+        unlink(node);
+        return owner(node);
+    }
+
+    template<typename T, typename Tag>
+    T& IntrusiveDoublyLinkedList<T, Tag>::pop_front() {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        auto node = root_.next_;
+        unlink(node);
+        return owner(node);
+    }
+
+    template<typename T, typename Tag>
+    void IntrusiveDoublyLinkedList<T, Tag>::erase(T& obj) {
+        if (!hook(obj)->is_linked())
+            throw std::out_of_range("NOT LINKED");
+        unlink(hook(obj));
+    }
+
+    template<typename T, typename Tag>
+    T& IntrusiveDoublyLinkedList<T, Tag>::front() {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        return owner(root_.next_);
+    }
+
+    template<typename T, typename Tag>
+    const T& IntrusiveDoublyLinkedList<T, Tag>::front() const {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        return owner(root_.next_);
+    }
+
+    template<typename T, typename Tag>
+    T& IntrusiveDoublyLinkedList<T, Tag>::back() {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        return owner(root_.prev_);
+    }
+
+    template<typename T, typename Tag>
+    const T& IntrusiveDoublyLinkedList<T, Tag>::back() const {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        return owner(root_.prev_);
+    }
+
+    template<typename T, typename Tag>
+    bool IntrusiveDoublyLinkedList<T, Tag>::empty() const {
+        return size() == 0u;
+    }
+
+    template<typename T, typename Tag>
+    std::size_t IntrusiveDoublyLinkedList<T, Tag>::size() const {
+        return size_;
+    }
+
+    template<typename T, typename Tag>
+    typename IntrusiveDoublyLinkedList<T, Tag>::iterator
+    IntrusiveDoublyLinkedList<T, Tag>::begin() {
+        return iterator{root_.next_};
+    }
+
+    template<typename T, typename Tag>
+    typename IntrusiveDoublyLinkedList<T, Tag>::const_iterator
+    IntrusiveDoublyLinkedList<T, Tag>::begin() const {
+        return const_iterator{root_.next_};
+    }
+
+    template<typename T, typename Tag>
+    typename IntrusiveDoublyLinkedList<T, Tag>::const_iterator
+    IntrusiveDoublyLinkedList<T, Tag>::cbegin() const {
+        return begin();
+    }
+
+    template<typename T, typename Tag>
+    typename IntrusiveDoublyLinkedList<T, Tag>::iterator
+    IntrusiveDoublyLinkedList<T, Tag>::end() {
+        return iterator{&root_};
+    }
+
+    template<typename T, typename Tag>
+    typename IntrusiveDoublyLinkedList<T, Tag>::const_iterator
+    IntrusiveDoublyLinkedList<T, Tag>::end() const {
+        return const_iterator{&root_};
+    }
+
+    template<typename T, typename Tag>
+    typename IntrusiveDoublyLinkedList<T, Tag>::const_iterator
+    IntrusiveDoublyLinkedList<T, Tag>::cend() const {
+        return end();
+    }
+
+    template<typename T, typename Tag>
+    void IntrusiveDoublyLinkedList<T, Tag>::link_before(Hook* position,
+                                                        Hook* node) {
+        if (node->is_linked())
+            throw std::out_of_range("ALREADY LINKED");
+        node->prev_ = position->prev_;
+        node->next_ = position;
+        position->prev_->next_ = node;
+        position->prev_ = node;
+        ++size_;
+    }
+
+    template<typename T, typename Tag>
+    void IntrusiveDoublyLinkedList<T, Tag>::unlink(Hook* node) {
+        node->prev_->next_ = node->next_;
+        node->next_->prev_ = node->prev_;
+        node->prev_ = nullptr;
+        node->next_ = nullptr;
+        --size_;
+    }
+
+    template<typename T, typename Tag>
+    void IntrusiveDoublyLinkedList<T, Tag>::take(
+        IntrusiveDoublyLinkedList& other) {
+        if (other.empty())
+            return;
+        root_.next_ = other.root_.next_;
+        root_.prev_ = other.root_.prev_;
+        root_.next_->prev_ = &root_;
+        root_.prev_->next_ = &root_;
+        size_ = other.size_;
+        other.root_.prev_ = &other.root_;
+        other.root_.next_ = &other.root_;
+        other.size_ = 0u;
+    }
+
+}  // namespace structures
+
+#endif
@@ -0,0 +1,203 @@
+/* Copyright [2017] <Luiz Motta> */
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "intrusive_doubly_linked_list.h"
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+/**
+ * Teste unitario para lista duplamente encadeada intrusiva
+ */
+
+struct ByAge {};
+struct ByName {};
+
+/**
+ * Objeto com um gancho por Tag, podendo estar em duas listas ao mesmo tempo
+ */
+struct Item: structures::IntrusiveListHook<ByAge>,
+             structures::IntrusiveListHook<ByName> {
+    explicit Item(int value): value{value} {}
+
+    bool linked_by_age() const {
+        return structures::IntrusiveListHook<ByAge>::is_linked();
+    }
+
+    bool linked_by_name() const {
+        return structures::IntrusiveListHook<ByName>::is_linked();
+    }
+
+    int value;
+};
+
+class IntrusiveDoublyLinkedListTest: public ::testing::Test {
+protected:
+    using List = structures::IntrusiveDoublyLinkedList<Item, ByAge>;
+
+    void SetUp() override {
+        for (auto i = 0; i < 5; ++i) {
+            items.emplace_back(i);
+        }
+    }
+
+    /**
+     * Valores dos objetos da lista, percorrida nos dois sentidos
+     */
+    template<typename L>
+    static std::vector<int> values(const L& list) {
+        std::vector<int> forward;
+        for (const auto& item : list) {
+            forward.push_back(item.value);
+        }
+        std::vector<int> backward;
+        for (auto it = list.end(); it != list.begin();) {
+            backward.insert(backward.begin(), (--it)->value);
+        }
+        EXPECT_EQ(forward, backward);
+        EXPECT_EQ(forward.size(), list.size());
+        return forward;
+    }
+
+    /**
+     * Objetos ligados nas listas; declarados antes delas para que as listas
+     * sejam destruidas primeiro.
+     */
+    std::vector<Item> items;
+
+    /**
+     * Lista na qual serao efetuadas as operações
+     */
+    List list;
+};
+
+TEST_F(IntrusiveDoublyLinkedListTest, PushAndPop) {
+    ASSERT_TRUE(list.empty());
+    list.push_back(items[1]);
+    list.push_back(items[2]);
+    list.push_front(items[0]);
+    list.insert(items[2], items[3]);
+    ASSERT_EQ((std::vector<int>{0, 1, 3, 2}), values(list));
+    ASSERT_EQ(0, list.front().value);
+    ASSERT_EQ(2, list.back().value);
+
+    list.erase(items[1]);
+    ASSERT_FALSE(items[1].linked_by_age());
+    ASSERT_EQ((std::vector<int>{0, 3, 2}), values(list));
+    ASSERT_EQ(&items[2], &list.pop_back());
+    ASSERT_EQ(&items[0], &list.pop_front());
+    ASSERT_FALSE(items[0].linked_by_age());
+    ASSERT_EQ((std::vector<int>{3}), values(list));
+    ASSERT_EQ(&items[3], &list.pop_front());
+    ASSERT_TRUE(list.empty());
+}
+
+TEST_F(IntrusiveDoublyLinkedListTest, Errors) {
+    ASSERT_THROW(list.pop_back(), std::out_of_range);
+    ASSERT_THROW(list.pop_front(), std::out_of_range);
+    ASSERT_THROW(list.front(), std::out_of_range);
+    ASSERT_THROW(list.back(), std::out_of_range);
+    ASSERT_THROW(list.erase(items[0]), std::out_of_range);
+    ASSERT_THROW(list.insert(items[0], items[1]), std::out_of_range);
+
+    list.push_back(items[0]);
+    ASSERT_THROW(list.push_back(items[0]), std::out_of_range);
+    ASSERT_THROW(list.push_front(items[0]), std::out_of_range);
+    ASSERT_THROW(list.insert(items[0], items[0]), std::out_of_range);
+
+    // Ligado em outra lista da mesma Tag tambem conta.
+    List other;
+    ASSERT_THROW(other.push_back(items[0]), std::out_of_range);
+    ASSERT_EQ(1u, list.size());
+    ASSERT_TRUE(other.empty());
+}
+
+TEST_F(IntrusiveDoublyLinkedListTest, TwoTags) {
+    structures::IntrusiveDoublyLinkedList<Item, ByName> by_name;
+    for (auto& item : items) {
+        list.push_back(item);
+        by_name.push_front(item);
+    }
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3, 4}), values(list));
+    ASSERT_EQ((std::vector<int>{4, 3, 2, 1, 0}), values(by_name));
+
+    // Sair de uma lista nao mexe nas ligacoes da outra Tag.
+    list.erase(items[2]);
+    ASSERT_FALSE(items[2].linked_by_age());
+    ASSERT_TRUE(items[2].linked_by_name());
+    ASSERT_EQ((std::vector<int>{4, 3, 2, 1, 0}), values(by_name));
+    by_name.erase(items[3]);
+    ASSERT_EQ((std::vector<int>{0, 1, 3, 4}), values(list));
+    ASSERT_EQ((std::vector<int>{4, 2, 1, 0}), values(by_name));
+}
+
+TEST_F(IntrusiveDoublyLinkedListTest, CopyStartsUnlinked) {
+    list.push_back(items[0]);
+    Item copy{items[0]};
+    ASSERT_FALSE(copy.linked_by_age());
+    list.push_back(copy);
+    copy = items[0];
+    ASSERT_TRUE(copy.linked_by_age());
+    ASSERT_EQ((std::vector<int>{0, 0}), values(list));
+    list.clear();
+}
+
+/**
+ * Mover a lista religa o primeiro e o ultimo objeto no sentinela da nova
+ * lista; a antiga fica vazia e pode ser usada de novo.
+ */
+TEST_F(IntrusiveDoublyLinkedListTest, Move) {
+    for (auto& item : items) {
+        list.push_back(item);
+    }
+    List moved{std::move(list)};
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.begin(), list.end());
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3, 4}), values(moved));
+    moved.erase(items[4]);
+    ASSERT_EQ(&items[3], &moved.back());
+
+    list.push_back(items[4]);
+    list = std::move(moved);
+    // Os objetos que estavam em list foram desligados.
+    ASSERT_FALSE(items[4].linked_by_age());
+    ASSERT_TRUE(moved.empty());
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3}), values(list));
+    ASSERT_EQ(&items[3], &list.pop_back());
+    list.push_front(items[4]);
+    ASSERT_EQ(&items[4], &list.front());
+
+    moved.push_back(items[3]);
+    ASSERT_EQ((std::vector<int>{3}), values(moved));
+
+    List empty;
+    list = std::move(empty);
+    ASSERT_TRUE(list.empty());
+    ASSERT_FALSE(items[0].linked_by_age());
+}
+
+TEST_F(IntrusiveDoublyLinkedListTest, ClearAndDestructorUnlink) {
+    for (auto& item : items) {
+        list.push_back(item);
+    }
+    list.clear();
+    ASSERT_TRUE(list.empty());
+    for (auto& item : items) {
+        ASSERT_FALSE(item.linked_by_age());
+    }
+    {
+        List scoped;
+        for (auto& item : items) {
+            scoped.push_back(item);
+        }
+        ASSERT_TRUE(items[0].linked_by_age());
+    }
+    for (auto& item : items) {
+        ASSERT_FALSE(item.linked_by_age());
+        list.push_back(item);
+    }
+    ASSERT_EQ(5u, list.size());
+}
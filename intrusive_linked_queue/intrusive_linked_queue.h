@@ -0,0 +1,208 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_INTRUSIVE_LINKED_QUEUE_H
+#define STRUCTURES_INTRUSIVE_LINKED_QUEUE_H
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "../intrusive_doubly_linked_list/intrusive_doubly_linked_list.h"
+
+namespace structures {
+
+/*!
+ * \brief Fila intrusiva: guarda referencias para objetos que herdam
+ * IntrusiveListHook<Tag>, sem alocar.
+ *
+ * Usa o mesmo gancho duplamente encadeado da IntrusiveDoublyLinkedList,
+ * entao alem de enqueue/dequeue um objeto pode sair do meio da fila em
+ * O(1) com erase(obj) (por exemplo, uma conexao que fechou antes de ser
+ * atendida).
+ */
+template<typename T, typename Tag = void>
+class IntrusiveLinkedQueue {
+ public:
+    using value_type = T;
+    using iterator = typename IntrusiveDoublyLinkedList<T, Tag>::iterator;
+    using const_iterator =
+        typename IntrusiveDoublyLinkedList<T, Tag>::const_iterator;
+
+    /*!
+     * \brief Remove todos os objetos da fila
+     */
+    void clear();
+
+    /*!
+     * \brief Coloca um objeto no final da fila
+     *
+     * \param obj objeto que nao esta em nenhuma lista desta Tag
+     */
+    void enqueue(T& obj);
+
+    /*!
+     * \brief Retira o objeto do inicio da fila
+     *
+     * \return referencia do objeto retirado
+     */
+    T& dequeue();
+
+    /*!
+     * \brief Retira um objeto de qualquer posicao da fila em O(1)
+     *
+     * \param obj objeto ligado nesta fila
+     */
+    void erase(T& obj);
+
+    /*!
+     * \brief Passa a referencia do objeto do inicio da fila
+     *
+     * \return referencia do primeiro objeto
+     */
+    T& front();
+
+    /*!
+     * \brief Passa a referencia do objeto do final da fila
+     *
+     * \return referencia do ultimo objeto
+     */
+    T& back();
+
+    /*!
+     * \brief Verifica se a fila esta vazia
+     *
+     * \return true caso a fila esteja vazia, caso contrario false
+     */
+    bool empty() const;
+
+    /*!
+     * \brief Passa o tamanho da fila
+     *
+     * \return tamanho da fila
+     */
+    std::size_t size() const;
+
+    /*!
+     * \brief Iterador para o primeiro objeto
+     *
+     * \return iterador para o primeiro objeto
+     */
+    iterator begin();
+
+    /*!
+     * \brief Iterador constante para o primeiro objeto
+     *
+     * \return iterador constante para o primeiro objeto
+     */
+    const_iterator begin() const;
+
+    /*!
+     * \brief Iterador constante para o primeiro objeto
+     *
+     * \return iterador constante para o primeiro objeto
+     */
+    const_iterator cbegin() const;
+
+    /*!
+     * \brief Iterador para depois do ultimo objeto
+     *
+     * \return iterador para o fim
+     */
+    iterator end();
+
+    /*!
+     * \brief Iterador constante para depois do ultimo objeto
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator end() const;
+
+    /*!
+     * \brief Iterador constante para depois do ultimo objeto
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator cend() const;
+
+ private:
+    IntrusiveDoublyLinkedList<T, Tag> list_;
+};
+
+    template<typename T, typename Tag>
+    void IntrusiveLinkedQueue<T, Tag>::clear() {
+        list_.clear();
+    }
+
+    template<typename T, typename Tag>
+    void IntrusiveLinkedQueue<T, Tag>::enqueue(T& obj) {
+        list_.push_back(obj);
+    }
+
+    template<typename T, typename Tag>
+    T& IntrusiveLinkedQueue<T, Tag>::dequeue() {
+        return list_.pop_front();
+    }
+
+    template<typename T, typename Tag>
+    void IntrusiveLinkedQueue<T, Tag>::erase(T& obj) {
+        list_.erase(obj);
+    }
+
+    template<typename T, typename Tag>
+    T& IntrusiveLinkedQueue<T, Tag>::front() {
+        return list_.front();
+    }
+
+    template<typename T, typename Tag>
+    T& IntrusiveLinkedQueue<T, Tag>::back() {
+        return list_.back();
+    }
+
+    template<typename T, typename Tag>
+    bool IntrusiveLinkedQueue<T, Tag>::empty() const {
+        return list_.empty();
+    }
+
+    template<typename T, typename Tag>
+    std::size_t IntrusiveLinkedQueue<T, Tag>::size() const {
+        return list_.size();
+    }
+
+    template<typename T, typename Tag>
+    typename IntrusiveLinkedQueue<T, Tag>::iterator
+    IntrusiveLinkedQueue<T, Tag>::begin() {
+        return list_.begin();
+    }
+
+    template<typename T, typename Tag>
+    typename IntrusiveLinkedQueue<T, Tag>::const_iterator
+    IntrusiveLinkedQueue<T, Tag>::begin() const {
+        return list_.begin();
+    }
+
+    template<typename T, typename Tag>
+    typename IntrusiveLinkedQueue<T, Tag>::const_iterator
+    IntrusiveLinkedQueue<T, Tag>::cbegin() const {
+        return list_.cbegin();
+    }
+
+    template<typename T, typename Tag>
+    typename IntrusiveLinkedQueue<T, Tag>::iterator
+    IntrusiveLinkedQueue<T, Tag>::end() {
+        return list_.end();
+    }
+
+    template<typename T, typename Tag>
+    typename IntrusiveLinkedQueue<T, Tag>::const_iterator
+    IntrusiveLinkedQueue<T, Tag>::end() const {
+        return list_.end();
+    }
+
+    template<typename T, typename Tag>
+    typename IntrusiveLinkedQueue<T, Tag>::const_iterator
+    IntrusiveLinkedQueue<T, Tag>::cend() const {
+        return list_.cend();
+    }
+
+}  // namespace structures
+
+#endif
@@ -0,0 +1,171 @@
+/* Copyright [2017] <Luiz Motta> */
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "intrusive_linked_queue.h"
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+/**
+ * Teste unitario para fila intrusiva
+ */
+
+struct Ready {};
+struct Timeout {};
+
+/**
+ * Conexao que espera atendimento e, ao mesmo tempo, o seu timeout
+ */
+struct Connection: structures::IntrusiveListHook<Ready>,
+                   structures::IntrusiveListHook<Timeout> {
+    explicit Connection(int id): id{id} {}
+
+    bool ready() const {
+        return structures::IntrusiveListHook<Ready>::is_linked();
+    }
+
+    bool waiting_timeout() const {
+        return structures::IntrusiveListHook<Timeout>::is_linked();
+    }
+
+    int id;
+};
+
+class IntrusiveLinkedQueueTest: public ::testing::Test {
+protected:
+    using Queue = structures::IntrusiveLinkedQueue<Connection, Ready>;
+
+    void SetUp() override {
+        for (auto i = 0; i < 5; ++i) {
+            connections.emplace_back(i);
+        }
+    }
+
+    /**
+     * Ids das conexoes na ordem da fila
+     */
+    template<typename Q>
+    static std::vector<int> ids(const Q& queue) {
+        std::vector<int> result;
+        for (const auto& connection : queue) {
+            result.push_back(connection.id);
+        }
+        EXPECT_EQ(result.size(), queue.size());
+        return result;
+    }
+
+    /**
+     * Objetos ligados nas filas; declarados antes delas para que as filas
+     * sejam destruidas primeiro.
+     */
+    std::vector<Connection> connections;
+
+    /**
+     * Fila na qual serao efetuadas as operações
+     */
+    Queue queue;
+};
+
+TEST_F(IntrusiveLinkedQueueTest, EnqueueAndDequeue) {
+    ASSERT_TRUE(queue.empty());
+    for (auto& connection : connections) {
+        queue.enqueue(connection);
+    }
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3, 4}), ids(queue));
+    ASSERT_EQ(&connections[0], &queue.front());
+    ASSERT_EQ(&connections[4], &queue.back());
+
+    // Sai do meio da fila em O(1).
+    queue.erase(connections[2]);
+    ASSERT_FALSE(connections[2].ready());
+    for (auto id : {0, 1, 3, 4}) {
+        auto& connection = queue.dequeue();
+        ASSERT_EQ(id, connection.id);
+        ASSERT_FALSE(connection.ready());
+    }
+    ASSERT_TRUE(queue.empty());
+
+    // Desligada, a conexao pode voltar para a fila.
+    queue.enqueue(connections[2]);
+    ASSERT_EQ(&connections[2], &queue.dequeue());
+}
+
+TEST_F(IntrusiveLinkedQueueTest, Errors) {
+    ASSERT_THROW(queue.dequeue(), std::out_of_range);
+    ASSERT_THROW(queue.front(), std::out_of_range);
+    ASSERT_THROW(queue.back(), std::out_of_range);
+    ASSERT_THROW(queue.erase(connections[0]), std::out_of_range);
+
+    queue.enqueue(connections[0]);
+    ASSERT_THROW(queue.enqueue(connections[0]), std::out_of_range);
+    Queue other;
+    ASSERT_THROW(other.enqueue(connections[0]), std::out_of_range);
+    ASSERT_EQ(1u, queue.size());
+    ASSERT_TRUE(other.empty());
+}
+
+TEST_F(IntrusiveLinkedQueueTest, TwoTags) {
+    structures::IntrusiveLinkedQueue<Connection, Timeout> timeouts;
+    for (auto& connection : connections) {
+        queue.enqueue(connection);
+        timeouts.enqueue(connection);
+    }
+    // A conexao atendida sai da fila de prontas mas segue com timeout.
+    auto& served = queue.dequeue();
+    ASSERT_TRUE(served.waiting_timeout());
+    ASSERT_EQ(&served, &timeouts.front());
+
+    // A que estourou o timeout sai das duas.
+    auto& expired = timeouts.dequeue();
+    ASSERT_EQ(&served, &expired);
+    auto& late = timeouts.dequeue();
+    queue.erase(late);
+    ASSERT_FALSE(late.ready());
+    ASSERT_FALSE(late.waiting_timeout());
+    ASSERT_EQ((std::vector<int>{2, 3, 4}), ids(queue));
+    ASSERT_EQ((std::vector<int>{2, 3, 4}), ids(timeouts));
+}
+
+TEST_F(IntrusiveLinkedQueueTest, Move) {
+    for (auto& connection : connections) {
+        queue.enqueue(connection);
+    }
+    Queue moved{std::move(queue)};
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3, 4}), ids(moved));
+    ASSERT_EQ(&connections[0], &moved.dequeue());
+    ASSERT_EQ(&connections[4], &moved.back());
+
+    queue.enqueue(connections[0]);
+    queue = std::move(moved);
+    ASSERT_FALSE(connections[0].ready());
+    ASSERT_TRUE(moved.empty());
+    ASSERT_EQ((std::vector<int>{1, 2, 3, 4}), ids(queue));
+    queue.enqueue(connections[0]);
+    ASSERT_EQ(&connections[0], &queue.back());
+    moved.enqueue(queue.dequeue());
+    ASSERT_EQ((std::vector<int>{1}), ids(moved));
+}
+
+TEST_F(IntrusiveLinkedQueueTest, ClearAndDestructorUnlink) {
+    for (auto& connection : connections) {
+        queue.enqueue(connection);
+    }
+    queue.clear();
+    ASSERT_TRUE(queue.empty());
+    {
+        Queue scoped;
+        for (auto& connection : connections) {
+            ASSERT_FALSE(connection.ready());
+            scoped.enqueue(connection);
+        }
+    }
+    for (auto& connection : connections) {
+        ASSERT_FALSE(connection.ready());
+        queue.enqueue(connection);
+    }
+    ASSERT_EQ(5u, queue.size());
+}
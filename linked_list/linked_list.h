@@ -5,6 +5,10 @@
 
 #include <stdexcept>
 #include <cstdint>
+#include <utility>
+
+#include "../node_iterator/node_iterator.h"
+#include "../node_pool/node_pool.h"
 
 namespace structures {
 /*!
@@ -13,9 +17,40 @@ namespace structures {
  *
  *
  */
-template<typename T>
+template<typename T, typename Alloc = HeapAllocator>
 class LinkedList {
+    class Node;
+
  public:
+    using value_type = T;
+    using iterator = ForwardNodeIterator<T, Node>;
+    using const_iterator = ForwardNodeIterator<const T, const Node>;
+
+    /*!
+     * \brief Construtor da lista vazia
+     */
+    LinkedList() = default;
+
+    /*!
+     * \brief Construtor de copia, copia todos os elementos de other
+     */
+    LinkedList(const LinkedList& other);
+
+    /*!
+     * \brief Construtor de movimento, assume os Nodes de other sem alocar
+     */
+    LinkedList(LinkedList&& other) noexcept;
+
+    /*!
+     * \brief Atribuicao por copia
+     */
+    LinkedList& operator=(const LinkedList& other);
+
+    /*!
+     * \brief Atribuicao por movimento
+     */
+    LinkedList& operator=(LinkedList&& other) noexcept;
+
     /*!
      *
      * TODO: DOCUMENTATION!
@@ -24,6 +59,11 @@ class LinkedList {
      */
     ~LinkedList();
 
+    /*!
+     * \brief Troca o conteudo com outra lista em O(1)
+     */
+    void swap(LinkedList& other) noexcept;
+
     /*!
      *
      * TODO: DOCUMENTATION!
@@ -40,6 +80,23 @@ class LinkedList {
      */
     void push_back(const T& data);
 
+    /*!
+     * \brief Adiciona um elemento no final, movendo o dado
+     *
+     * \param data dado a ser armazenado
+     */
+    void push_back(T&& data);
+
+    /*!
+     * \brief Constroi um elemento no final da lista
+     *
+     * \param args argumentos repassados ao construtor de T
+     *
+     * \return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace_back(Args&&... args);
+
     /*!
      *
      * TODO: DOCUMENTATION!
@@ -48,6 +105,23 @@ class LinkedList {
      */
     void push_front(const T& data);
 
+    /*!
+     * \brief Adiciona um elemento no inicio, movendo o dado
+     *
+     * \param data dado a ser armazenado
+     */
+    void push_front(T&& data);
+
+    /*!
+     * \brief Constroi um elemento no inicio da lista
+     *
+     * \param args argumentos repassados ao construtor de T
+     *
+     * \return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace_front(Args&&... args);
+
     /*!
      *
      * TODO: DOCUMENTATION!
@@ -56,6 +130,25 @@ class LinkedList {
      */
     void insert(const T& data, std::size_t index);
 
+    /*!
+     * \brief Adiciona um elemento na posicao, movendo o dado
+     *
+     * \param data dado a ser armazenado
+     * \param index posicao do novo elemento
+     */
+    void insert(T&& data, std::size_t index);
+
+    /*!
+     * \brief Constroi um elemento na posicao
+     *
+     * \param index posicao do novo elemento
+     * \param args argumentos repassados ao construtor de T
+     *
+     * \return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace(std::size_t index, Args&&... args);
+
     /*!
      *
      * TODO: DOCUMENTATION!
@@ -144,12 +237,81 @@ class LinkedList {
      */
     T& operator[](std::size_t index);
 
+    /*!
+     * \brief Acessa o primeiro elemento da lista
+     *
+     * \return referencia do primeiro elemento
+     */
+    T& front();
+
+    /*!
+     * \brief Acessa o ultimo elemento da lista em O(1)
+     *
+     * \return referencia do ultimo elemento
+     */
+    T& back();
+
+    /*!
+     * \brief Move todos os elementos de other para o final desta lista
+     *
+     * Os Nodes de other sao religados em O(1) quando o alocador permite
+     * (is_always_equal); com PoolAllocator e ThreadLocalPoolAllocator os
+     * dados sao movidos um a um. Ao final other fica vazia.
+     *
+     * \param other lista cujos elementos serao anexados
+     */
+    void append(LinkedList& other);
+
+    /*!
+     * \brief Iterador para o primeiro elemento
+     *
+     * \return iterador para o primeiro elemento
+     */
+    iterator begin();
+
+    /*!
+     * \brief Iterador constante para o primeiro elemento
+     *
+     * \return iterador constante para o primeiro elemento
+     */
+    const_iterator begin() const;
+
+    /*!
+     * \brief Iterador constante para o primeiro elemento
+     *
+     * \return iterador constante para o primeiro elemento
+     */
+    const_iterator cbegin() const;
+
+    /*!
+     * \brief Iterador para depois do ultimo elemento
+     *
+     * \return iterador para o fim
+     */
+    iterator end();
+
+    /*!
+     * \brief Iterador constante para depois do ultimo elemento
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator end() const;
+
+    /*!
+     * \brief Iterador constante para depois do ultimo elemento
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator cend() const;
+
  private:
     class Node {
      public:
-        explicit Node(const T& data): data_{data} {}
-
-        Node(const T& data, Node* next): data_{data}, next_{next} {}
+        template<typename... Args>
+        Node(std::in_place_t, Node* next, Args&&... args):
+            data_(std::forward<Args>(args)...),
+            next_{next}
+        {}
 
         T& data() { return data_; }
 
@@ -166,8 +328,6 @@ class LinkedList {
         Node* next_{nullptr};
     };
 
-    Node* end() { return nodeAt(size_); }
-
     Node* nodeAt(std::size_t index) {
         if (index >= size_)
             throw std::out_of_range("INDEX OUT OF BOUNDS AT");
@@ -178,40 +338,140 @@ class LinkedList {
         return it;
     }
 
+    typename Alloc::template rebind<Node> alloc_;
     Node* head{nullptr};
+    Node* tail{nullptr};
     std::size_t size_{0u};
 };
 
-    template<class T>
-    LinkedList<T>::~LinkedList() { clear(); }
+    template<typename T, typename Alloc>
+    LinkedList<T, Alloc>::LinkedList(const LinkedList& other) :
+        alloc_{other.alloc_}
+    {
+        try {
+            for (auto& data : other)
+                push_back(data);
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
 
-    template<class T>
-    void LinkedList<T>::clear() {
+    template<typename T, typename Alloc>
+    LinkedList<T, Alloc>::LinkedList(LinkedList&& other) noexcept :
+        alloc_{std::move(other.alloc_)},
+        head{std::exchange(other.head, nullptr)},
+        tail{std::exchange(other.tail, nullptr)},
+        size_{std::exchange(other.size_, 0u)}
+    {}
+
+    template<typename T, typename Alloc>
+    LinkedList<T, Alloc>& LinkedList<T, Alloc>::operator=(
+        const LinkedList& other) {
+        if (this != &other) {
+            LinkedList copy{other};
+            swap(copy);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Alloc>
+    LinkedList<T, Alloc>& LinkedList<T, Alloc>::operator=(
+        LinkedList&& other) noexcept {
+        if (this != &other) {
+            LinkedList moved{std::move(other)};
+            swap(moved);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Alloc>
+    LinkedList<T, Alloc>::~LinkedList() { clear(); }
+
+    template<typename T, typename Alloc>
+    void LinkedList<T, Alloc>::swap(LinkedList& other) noexcept {
+        std::swap(alloc_, other.alloc_);
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(size_, other.size_);
+    }
+
+    template<typename T, typename Alloc>
+    void LinkedList<T, Alloc>::clear() {
         while (!empty()) {
             pop_front();
         }
     }
 
-    template<class T>
-    void LinkedList<T>::push_back(const T &data) { insert(data, size_); }
+    template<typename T, typename Alloc>
+    void LinkedList<T, Alloc>::push_back(const T &data) {
+        emplace_back(data);
+    }
+
+    template<typename T, typename Alloc>
+    void LinkedList<T, Alloc>::push_back(T&& data) {
+        emplace_back(std::move(data));
+    }
+
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    T& LinkedList<T, Alloc>::emplace_back(Args&&... args) {
+        if (empty())
+            return emplace_front(std::forward<Args>(args)...);
+        auto new_node = alloc_.create(std::in_place, nullptr,
+                                      std::forward<Args>(args)...);
+        tail->next(new_node);
+        tail = new_node;
+        ++size_;
+        return new_node->data();
+    }
+
+    template<typename T, typename Alloc>
+    void LinkedList<T, Alloc>::push_front(const T &data) {
+        emplace_front(data);
+    }
 
-    template<class T>
-    void LinkedList<T>::push_front(const T &data) {
-        head = new Node(data, head);
+    template<typename T, typename Alloc>
+    void LinkedList<T, Alloc>::push_front(T&& data) {
+        emplace_front(std::move(data));
+    }
+
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    T& LinkedList<T, Alloc>::emplace_front(Args&&... args) {
+        head = alloc_.create(std::in_place, head, std::forward<Args>(args)...);
+        if (tail == nullptr)
+            tail = head;
         ++size_;
+        return head->data();
     }
 
-    template<class T>
-    void LinkedList<T>::insert(const T &data, std::size_t index) {
+    template<typename T, typename Alloc>
+    void LinkedList<T, Alloc>::insert(const T &data, std::size_t index) {
+        emplace(index, data);
+    }
+
+    template<typename T, typename Alloc>
+    void LinkedList<T, Alloc>::insert(T&& data, std::size_t index) {
+        emplace(index, std::move(data));
+    }
+
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    T& LinkedList<T, Alloc>::emplace(std::size_t index, Args&&... args) {
         if (index == 0)
-            return push_front(data);
+            return emplace_front(std::forward<Args>(args)...);
+        if (index == size_)
+            return emplace_back(std::forward<Args>(args)...);
         auto it = nodeAt(index-1);
-        it->next(new Node(data, it->next()));
+        it->next(alloc_.create(std::in_place, it->next(),
+                               std::forward<Args>(args)...));
         ++size_;
+        return it->next()->data();
     }
 
-    template<class T>
-    void LinkedList<T>::insert_sorted(const T &data) {
+    template<typename T, typename Alloc>
+    void LinkedList<T, Alloc>::insert_sorted(const T &data) {
         if (empty() || data <= head->data()) {
             return push_front(data);
         }
@@ -220,15 +480,17 @@ class LinkedList {
             if (data < it->next()->data())
                 break;
         }
-        it->next(new Node(data, it->next()));
+        it->next(alloc_.create(std::in_place, it->next(), data));
+        if (it == tail)
+            tail = it->next();
         ++size_;
     }
 
-    template<class T>
-    T &LinkedList<T>::at(std::size_t index) { return nodeAt(index)->data(); }
+    template<typename T, typename Alloc>
+    T &LinkedList<T, Alloc>::at(std::size_t index) { return nodeAt(index)->data(); }
 
-    template<class T>
-    T LinkedList<T>::pop(std::size_t index) {
+    template<typename T, typename Alloc>
+    T LinkedList<T, Alloc>::pop(std::size_t index) {
         if (index >= size_)
             throw std::out_of_range("INDEX OUT OF BOUNDS POP");
         if (index == 0)
@@ -237,45 +499,48 @@ class LinkedList {
         auto to_delete = it->next();
         auto data = std::move(to_delete->data());
         it->next(to_delete->next());
+        if (to_delete == tail)
+            tail = it;
         --size_;
-        delete to_delete;
+        alloc_.destroy(to_delete);
         return data;
     }
 
-    template<class T>
-    T LinkedList<T>::pop_back() { return pop(size_-1); }
+    template<typename T, typename Alloc>
+    T LinkedList<T, Alloc>::pop_back() { return pop(size_-1); }
 
-    template<class T>
-    T LinkedList<T>::pop_front() {
+    template<typename T, typename Alloc>
+    T LinkedList<T, Alloc>::pop_front() {
         if (empty())
             throw std::out_of_range("EMPTY");
         auto old_head = head;
         auto data = std::move(head->data());
         head = head->next();
+        if (head == nullptr)
+            tail = nullptr;
         --size_;
-        delete old_head;
+        alloc_.destroy(old_head);
         return data;
     }
 
-    template<class T>
-    void LinkedList<T>::remove(const T &data) {
-        auto it = nodeAt(find(data)-1);
-        auto to_delete = it->next();
-        it->next(to_delete->next());
-        delete to_delete;
-        --size_;
+    template<typename T, typename Alloc>
+    void LinkedList<T, Alloc>::remove(const T &data) {
+        auto index = find(data);
+        if (index == size_)
+            throw std::out_of_range("NOT FOUND");
+        pop(index);
     }
 
-    template<class T>
-    bool LinkedList<T>::empty() const { return size() == 0u; }
+    template<typename T, typename Alloc>
+    bool LinkedList<T, Alloc>::empty() const { return size() == 0u; }
 
-    template<class T>
-    bool LinkedList<T>::contains(const T &data) const {
+    template<typename T, typename Alloc>
+    bool LinkedList<T, Alloc>::contains(const T &data) const {
         return find(data) != size_;
     }
 
-    template<class T>
-    std::size_t LinkedList<T>::find(const T &data) const {
+    template<typename T, typename Alloc>
+    std::size_t LinkedList<T, Alloc>::find(const T &data) const {
         auto it = head;
         std::size_t index = 0u;
         while (it != nullptr && it->data() != data) {
@@ -285,11 +550,81 @@ class LinkedList {
         return index;
     }
 
-    template<class T>
-    std::size_t LinkedList<T>::size() const { return size_; }
+    template<typename T, typename Alloc>
+    std::size_t LinkedList<T, Alloc>::size() const { return size_; }
 
-    template<class T>
-    T& LinkedList<T>::operator[](std::size_t index) { return at(index); }
+    template<typename T, typename Alloc>
+    T& LinkedList<T, Alloc>::operator[](std::size_t index) { return at(index); }
+
+    template<typename T, typename Alloc>
+    T& LinkedList<T, Alloc>::front() {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        return head->data();
+    }
+
+    template<typename T, typename Alloc>
+    T& LinkedList<T, Alloc>::back() {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        return tail->data();
+    }
+
+    template<typename T, typename Alloc>
+    void LinkedList<T, Alloc>::append(LinkedList& other) {
+        if (&other == this || other.empty())
+            return;
+        if constexpr (decltype(alloc_)::is_always_equal::value) {
+            if (empty())
+                head = other.head;
+            else
+                tail->next(other.head);
+            tail = other.tail;
+            size_ += other.size_;
+            other.head = nullptr;
+            other.tail = nullptr;
+            other.size_ = 0u;
+        } else {
+            while (!other.empty())
+                push_back(other.pop_front());
+        }
+    }
+
+    template<typename T, typename Alloc>
+    typename LinkedList<T, Alloc>::iterator
+    LinkedList<T, Alloc>::begin() {
+        return iterator{head, 0u};
+    }
+
+    template<typename T, typename Alloc>
+    typename LinkedList<T, Alloc>::const_iterator
+    LinkedList<T, Alloc>::begin() const {
+        return const_iterator{head, 0u};
+    }
+
+    template<typename T, typename Alloc>
+    typename LinkedList<T, Alloc>::const_iterator
+    LinkedList<T, Alloc>::cbegin() const {
+        return begin();
+    }
+
+    template<typename T, typename Alloc>
+    typename LinkedList<T, Alloc>::iterator
+    LinkedList<T, Alloc>::end() {
+        return iterator{nullptr, size_};
+    }
+
+    template<typename T, typename Alloc>
+    typename LinkedList<T, Alloc>::const_iterator
+    LinkedList<T, Alloc>::end() const {
+        return const_iterator{nullptr, size_};
+    }
+
+    template<typename T, typename Alloc>
+    typename LinkedList<T, Alloc>::const_iterator
+    LinkedList<T, Alloc>::cend() const {
+        return end();
+    }
 
 }  // namespace structures
 
@@ -5,6 +5,10 @@
 
 #include <stdexcept>
 #include <cstdint>
+#include <utility>
+
+#include "../node_iterator/node_iterator.h"
+#include "../node_pool/node_pool.h"
 
 namespace structures {
 
@@ -12,14 +16,50 @@ namespace structures {
 /*!
  * \brief LinkedQueue implementa uma fila encadeada
  */
-template<typename T>
+template<typename T, typename Alloc = HeapAllocator>
 class LinkedQueue {
+    class Node;
+
  public:
+    using value_type = T;
+    using iterator = ForwardNodeIterator<T, Node>;
+    using const_iterator = ForwardNodeIterator<const T, const Node>;
+
+    /*!
+     * \brief Construtor da fila vazia
+     */
+    LinkedQueue() = default;
+
+    /*!
+     * \brief Construtor de copia, copia todos os elementos de other
+     */
+    LinkedQueue(const LinkedQueue& other);
+
+    /*!
+     * \brief Construtor de movimento, assume os Nodes de other sem alocar
+     */
+    LinkedQueue(LinkedQueue&& other) noexcept;
+
+    /*!
+     * \brief Atribuicao por copia
+     */
+    LinkedQueue& operator=(const LinkedQueue& other);
+
+    /*!
+     * \brief Atribuicao por movimento
+     */
+    LinkedQueue& operator=(LinkedQueue&& other) noexcept;
+
     /*!
      * \brief Destrutor
      */
     ~LinkedQueue();
 
+    /*!
+     * \brief Troca o conteudo com outra fila em O(1)
+     */
+    void swap(LinkedQueue& other) noexcept;
+
     /*!
      * \brief Remove todos os elementos da fila
      */
@@ -32,6 +72,23 @@ class LinkedQueue {
      */
     void enqueue(const T& data);
 
+    /*!
+     * \brief Coloca um elemento no final da fila, movendo o dado
+     *
+     * \param data, dado a ser armazenado
+     */
+    void enqueue(T&& data);
+
+    /*!
+     * \brief Constroi um elemento no final da fila
+     *
+     * \param args, argumentos repassados ao construtor de T
+     *
+     * \return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace(Args&&... args);
+
     /*!
      * \brief Retira o elemento que está no final da fila
      *
@@ -67,12 +124,56 @@ class LinkedQueue {
      */
     std::size_t size() const;
 
+    /*!
+     * \brief Iterador para o primeiro elemento
+     *
+     * \return iterador para o primeiro elemento
+     */
+    iterator begin();
+
+    /*!
+     * \brief Iterador constante para o primeiro elemento
+     *
+     * \return iterador constante para o primeiro elemento
+     */
+    const_iterator begin() const;
+
+    /*!
+     * \brief Iterador constante para o primeiro elemento
+     *
+     * \return iterador constante para o primeiro elemento
+     */
+    const_iterator cbegin() const;
+
+    /*!
+     * \brief Iterador para depois do ultimo elemento
+     *
+     * \return iterador para o fim
+     */
+    iterator end();
+
+    /*!
+     * \brief Iterador constante para depois do ultimo elemento
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator end() const;
+
+    /*!
+     * \brief Iterador constante para depois do ultimo elemento
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator cend() const;
+
  private:
     class Node {
      public:
-        explicit Node(const T& data): data_{data} {}
-
-        Node(const T& data, Node* next): data_{data}, next_{next} {}
+        template<typename... Args>
+        Node(std::in_place_t, Node* next, Args&&... args):
+            data_(std::forward<Args>(args)...),
+            next_{next}
+        {}
 
         T& data() { return data_; }
 
@@ -89,67 +190,164 @@ class LinkedQueue {
         Node* next_{nullptr};
     };
 
+    typename Alloc::template rebind<Node> alloc_;
     Node* head{nullptr};
     Node* tail{nullptr};
     std::size_t size_{0u};
 };
 
-    template<typename T>
-    LinkedQueue<T>::~LinkedQueue() { clear(); }
+    template<typename T, typename Alloc>
+    LinkedQueue<T, Alloc>::LinkedQueue(const LinkedQueue& other) :
+        alloc_{other.alloc_}
+    {
+        try {
+            for (auto& data : other)
+                enqueue(data);
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    template<typename T, typename Alloc>
+    LinkedQueue<T, Alloc>::LinkedQueue(LinkedQueue&& other) noexcept :
+        alloc_{std::move(other.alloc_)},
+        head{std::exchange(other.head, nullptr)},
+        tail{std::exchange(other.tail, nullptr)},
+        size_{std::exchange(other.size_, 0u)}
+    {}
+
+    template<typename T, typename Alloc>
+    LinkedQueue<T, Alloc>& LinkedQueue<T, Alloc>::operator=(
+        const LinkedQueue& other) {
+        if (this != &other) {
+            LinkedQueue copy{other};
+            swap(copy);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Alloc>
+    LinkedQueue<T, Alloc>& LinkedQueue<T, Alloc>::operator=(
+        LinkedQueue&& other) noexcept {
+        if (this != &other) {
+            LinkedQueue moved{std::move(other)};
+            swap(moved);
+        }
+        return *this;
+    }
 
-    template<typename T>
-    void LinkedQueue<T>::clear() {
+    template<typename T, typename Alloc>
+    LinkedQueue<T, Alloc>::~LinkedQueue() { clear(); }
+
+    template<typename T, typename Alloc>
+    void LinkedQueue<T, Alloc>::swap(LinkedQueue& other) noexcept {
+        std::swap(alloc_, other.alloc_);
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(size_, other.size_);
+    }
+
+    template<typename T, typename Alloc>
+    void LinkedQueue<T, Alloc>::clear() {
         while (!empty()) {
             dequeue();
         }
     }
 
-    template<typename T>
-    void LinkedQueue<T>::enqueue(const T &data) {
-        if (empty()) {
-            tail = new Node(data);
-            head = tail;
-        } else {
-            auto it = tail;
-            it->next(new Node (data, tail->next()));
-            tail = it->next();
-        }
+    template<typename T, typename Alloc>
+    void LinkedQueue<T, Alloc>::enqueue(const T &data) {
+        emplace(data);
+    }
+
+    template<typename T, typename Alloc>
+    void LinkedQueue<T, Alloc>::enqueue(T&& data) {
+        emplace(std::move(data));
+    }
+
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    T& LinkedQueue<T, Alloc>::emplace(Args&&... args) {
+        auto node = alloc_.create(std::in_place, nullptr,
+                                  std::forward<Args>(args)...);
+        if (empty())
+            head = node;
+        else
+            tail->next(node);
+        tail = node;
         ++size_;
+        return node->data();
     }
 
-    template<typename T>
-    T LinkedQueue<T>::dequeue() {
+    template<typename T, typename Alloc>
+    T LinkedQueue<T, Alloc>::dequeue() {
         if (empty())
             throw std::out_of_range("EMPTY");
         if (size() == 1)
             tail = head->next();
-        auto to_delete = first();
+        auto to_delete = head;
         auto data = std::move(to_delete->data());
         head = head->next();
         --size_;
-        delete to_delete;
+        alloc_.destroy(to_delete);
         return data;
     }
 
-    template<typename T>
-    T& LinkedQueue<T>::front() const {
+    template<typename T, typename Alloc>
+    T& LinkedQueue<T, Alloc>::front() const {
         if (empty())
             throw std::out_of_range("EMPTY");
         return head->data();
     }
 
-    template<typename T>
-    T& LinkedQueue<T>::back() const {
+    template<typename T, typename Alloc>
+    T& LinkedQueue<T, Alloc>::back() const {
         if (empty())
             throw std::out_of_range("EMPTY");
         return tail->data();
     }
 
-    template<typename T>
-    bool LinkedQueue<T>::empty() const { return size() == 0u; }
+    template<typename T, typename Alloc>
+    bool LinkedQueue<T, Alloc>::empty() const { return size() == 0u; }
 
-    template<typename T>
-    std::size_t LinkedQueue<T>::size() const { return size_; }
+    template<typename T, typename Alloc>
+    std::size_t LinkedQueue<T, Alloc>::size() const { return size_; }
+
+    template<typename T, typename Alloc>
+    typename LinkedQueue<T, Alloc>::iterator
+    LinkedQueue<T, Alloc>::begin() {
+        return iterator{head, 0u};
+    }
+
+    template<typename T, typename Alloc>
+    typename LinkedQueue<T, Alloc>::const_iterator
+    LinkedQueue<T, Alloc>::begin() const {
+        return const_iterator{head, 0u};
+    }
+
+    template<typename T, typename Alloc>
+    typename LinkedQueue<T, Alloc>::const_iterator
+    LinkedQueue<T, Alloc>::cbegin() const {
+        return begin();
+    }
+
+    template<typename T, typename Alloc>
+    typename LinkedQueue<T, Alloc>::iterator
+    LinkedQueue<T, Alloc>::end() {
+        return iterator{nullptr, size_};
+    }
+
+    template<typename T, typename Alloc>
+    typename LinkedQueue<T, Alloc>::const_iterator
+    LinkedQueue<T, Alloc>::end() const {
+        return const_iterator{nullptr, size_};
+    }
+
+    template<typename T, typename Alloc>
+    typename LinkedQueue<T, Alloc>::const_iterator
+    LinkedQueue<T, Alloc>::cend() const {
+        return end();
+    }
 
 }  // namespace structures
 
@@ -5,20 +5,60 @@
 
 #include <stdexcept>
 #include <cstdint>
+#include <utility>
+
+#include "../node_iterator/node_iterator.h"
+#include "../node_pool/node_pool.h"
 
 namespace structures {
 
 /*!
  * \brief LinkedStack implementa uma pilha encadeada
  */    
-template<typename T>
+template<typename T, typename Alloc = HeapAllocator>
 class LinkedStack {
+    class Node;
+
  public:
+    using value_type = T;
+    using iterator = ForwardNodeIterator<T, Node>;
+    using const_iterator = ForwardNodeIterator<const T, const Node>;
+
+    /*!
+     * \brief Construtor da pilha vazia
+     */
+    LinkedStack() = default;
+
+    /*!
+     * \brief Construtor de copia, copia todos os elementos de other
+     */
+    LinkedStack(const LinkedStack& other);
+
+    /*!
+     * \brief Construtor de movimento, assume os Nodes de other sem alocar
+     */
+    LinkedStack(LinkedStack&& other) noexcept;
+
+    /*!
+     * \brief Atribuicao por copia
+     */
+    LinkedStack& operator=(const LinkedStack& other);
+
+    /*!
+     * \brief Atribuicao por movimento
+     */
+    LinkedStack& operator=(LinkedStack&& other) noexcept;
+
     /*!
      * \brief Destrutor
      */
     ~LinkedStack();
 
+    /*!
+     * \brief Troca o conteudo com outra pilha em O(1)
+     */
+    void swap(LinkedStack& other) noexcept;
+
     /*!
      * \brief Remove todos os elementos da pilha
      */
@@ -31,6 +71,23 @@ class LinkedStack {
      */
     void push(const T& data);
 
+    /*!
+     * \brief Coloca um elemento no topo da pilha, movendo o dado
+     *
+     * \param data, dado a ser armazenado
+     */
+    void push(T&& data);
+
+    /*!
+     * \brief Constroi um elemento no topo da pilha
+     *
+     * \param args, argumentos repassados ao construtor de T
+     *
+     * \return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace(Args&&... args);
+
     /*!
      * \brief Retira o elemento que está no topo da lista
      *
@@ -59,12 +116,56 @@ class LinkedStack {
      */
     std::size_t size() const;
 
+    /*!
+     * \brief Iterador para o primeiro elemento
+     *
+     * \return iterador para o primeiro elemento
+     */
+    iterator begin();
+
+    /*!
+     * \brief Iterador constante para o primeiro elemento
+     *
+     * \return iterador constante para o primeiro elemento
+     */
+    const_iterator begin() const;
+
+    /*!
+     * \brief Iterador constante para o primeiro elemento
+     *
+     * \return iterador constante para o primeiro elemento
+     */
+    const_iterator cbegin() const;
+
+    /*!
+     * \brief Iterador para depois do ultimo elemento
+     *
+     * \return iterador para o fim
+     */
+    iterator end();
+
+    /*!
+     * \brief Iterador constante para depois do ultimo elemento
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator end() const;
+
+    /*!
+     * \brief Iterador constante para depois do ultimo elemento
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator cend() const;
+
  private:
     class Node {
      public:
-        explicit Node(const T& data): data_{data} {}
-
-        Node(const T& data, Node* next): data_{data}, next_{next} {}
+        template<typename... Args>
+        Node(std::in_place_t, Node* next, Args&&... args):
+            data_(std::forward<Args>(args)...),
+            next_{next}
+        {}
 
         T& data() { return data_; }
 
@@ -81,52 +182,154 @@ class LinkedStack {
         Node* next_{nullptr};
     };
 
-    Node* end() { return top_; }
-
+    typename Alloc::template rebind<Node> alloc_;
     Node* top_{nullptr};
     std::size_t size_{0u};
 };
 
-    template<typename T>
-    LinkedStack<T>::~LinkedStack() { clear(); }
+    template<typename T, typename Alloc>
+    LinkedStack<T, Alloc>::LinkedStack(const LinkedStack& other) :
+        alloc_{other.alloc_}
+    {
+        try {
+            Node* last = nullptr;
+            for (auto& data : other) {
+                auto node = alloc_.create(std::in_place, nullptr, data);
+                if (last == nullptr)
+                    top_ = node;
+                else
+                    last->next(node);
+                last = node;
+                ++size_;
+            }
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    template<typename T, typename Alloc>
+    LinkedStack<T, Alloc>::LinkedStack(LinkedStack&& other) noexcept :
+        alloc_{std::move(other.alloc_)},
+        top_{std::exchange(other.top_, nullptr)},
+        size_{std::exchange(other.size_, 0u)}
+    {}
 
-    template<typename T>
-    void LinkedStack<T>::clear() {
+    template<typename T, typename Alloc>
+    LinkedStack<T, Alloc>& LinkedStack<T, Alloc>::operator=(
+        const LinkedStack& other) {
+        if (this != &other) {
+            LinkedStack copy{other};
+            swap(copy);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Alloc>
+    LinkedStack<T, Alloc>& LinkedStack<T, Alloc>::operator=(
+        LinkedStack&& other) noexcept {
+        if (this != &other) {
+            LinkedStack moved{std::move(other)};
+            swap(moved);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Alloc>
+    LinkedStack<T, Alloc>::~LinkedStack() { clear(); }
+
+    template<typename T, typename Alloc>
+    void LinkedStack<T, Alloc>::swap(LinkedStack& other) noexcept {
+        std::swap(alloc_, other.alloc_);
+        std::swap(top_, other.top_);
+        std::swap(size_, other.size_);
+    }
+
+    template<typename T, typename Alloc>
+    void LinkedStack<T, Alloc>::clear() {
         while (!empty()) {
             pop();
         }
     }
 
-    template<typename T>
-    void LinkedStack<T>::push(const T &data) {
-        top_ = new Node(data, top_);
+    template<typename T, typename Alloc>
+    void LinkedStack<T, Alloc>::push(const T &data) {
+        emplace(data);
+    }
+
+    template<typename T, typename Alloc>
+    void LinkedStack<T, Alloc>::push(T&& data) {
+        emplace(std::move(data));
+    }
+
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    T& LinkedStack<T, Alloc>::emplace(Args&&... args) {
+        top_ = alloc_.create(std::in_place, top_, std::forward<Args>(args)...);
         ++size_;
+        return top_->data();
     }
 
-    template<typename T>
-    T LinkedStack<T>::pop() {
+    template<typename T, typename Alloc>
+    T LinkedStack<T, Alloc>::pop() {
         if (empty())
             throw std::out_of_range("EMPTY");
-        auto to_delete = end();
+        auto to_delete = top_;
         auto data = std::move(to_delete->data());
         top_ = top_->next();
         --size_;
-        delete to_delete;
+        alloc_.destroy(to_delete);
         return data;
     }
 
-    template<typename T>
-    T& LinkedStack<T>::top() const {
+    template<typename T, typename Alloc>
+    T& LinkedStack<T, Alloc>::top() const {
         if (empty())
             throw std::out_of_range("EMPTY");
         return top_->data();
     }
 
-    template<typename T>
-    bool LinkedStack<T>::empty() const { return size() == 0u; }
+    template<typename T, typename Alloc>
+    bool LinkedStack<T, Alloc>::empty() const { return size() == 0u; }
 
-    template<typename T>
-    std::size_t LinkedStack<T>::size() const { return size_; }
+    template<typename T, typename Alloc>
+    std::size_t LinkedStack<T, Alloc>::size() const { return size_; }
+
+    template<typename T, typename Alloc>
+    typename LinkedStack<T, Alloc>::iterator
+    LinkedStack<T, Alloc>::begin() {
+        return iterator{top_, 0u};
+    }
+
+    template<typename T, typename Alloc>
+    typename LinkedStack<T, Alloc>::const_iterator
+    LinkedStack<T, Alloc>::begin() const {
+        return const_iterator{top_, 0u};
+    }
+
+    template<typename T, typename Alloc>
+    typename LinkedStack<T, Alloc>::const_iterator
+    LinkedStack<T, Alloc>::cbegin() const {
+        return begin();
+    }
+
+    template<typename T, typename Alloc>
+    typename LinkedStack<T, Alloc>::iterator
+    LinkedStack<T, Alloc>::end() {
+        return iterator{nullptr, size_};
+    }
+
+    template<typename T, typename Alloc>
+    typename LinkedStack<T, Alloc>::const_iterator
+    LinkedStack<T, Alloc>::end() const {
+        return const_iterator{nullptr, size_};
+    }
+
+    template<typename T, typename Alloc>
+    typename LinkedStack<T, Alloc>::const_iterator
+    LinkedStack<T, Alloc>::cend() const {
+        return end();
+    }
 
 }  // namespace structures
 
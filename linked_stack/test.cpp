@@ -1,5 +1,6 @@
 /* Copyright [2016] <João Paulo Taylor Ienczak Zanette> */
 #include "gtest/gtest.h"
+#include <string>
 #include "linked_stack.h"
 
 int main(int argc, char* argv[]) {
@@ -62,7 +63,6 @@ TEST_F(LinkedStackTest, Pop) {
 
     for (auto i = 0u; i < 10u; ++i) {
         ASSERT_EQ(9-i, stack.pop());
-        ASSERT_EQ(9-i, stack.pop());
     }
     ASSERT_TRUE(stack.empty());
 }
@@ -74,3 +74,40 @@ TEST_F(LinkedStackTest, TopEmpty) {
 TEST_F(LinkedStackTest, PopEmpty) {
     ASSERT_THROW(stack.pop(), std::out_of_range);
 }
+
+TEST_F(LinkedStackTest, Copy) {
+    for (auto i = 0; i < 10; ++i) {
+        stack.push(i);
+    }
+    auto copy = stack;
+    ASSERT_EQ(10u, copy.size());
+    for (auto i = 9; i >= 0; --i) {
+        ASSERT_EQ(i, copy.pop());
+    }
+    ASSERT_EQ(10u, stack.size());
+    ASSERT_EQ(9, stack.top());
+}
+
+TEST_F(LinkedStackTest, Move) {
+    for (auto i = 0; i < 10; ++i) {
+        stack.push(i);
+    }
+    auto moved = std::move(stack);
+    ASSERT_EQ(10u, moved.size());
+    ASSERT_EQ(9, moved.top());
+    ASSERT_TRUE(stack.empty());
+
+    stack.push(1);
+    stack = std::move(moved);
+    ASSERT_EQ(10u, stack.size());
+    ASSERT_EQ(9, stack.top());
+}
+
+TEST_F(LinkedStackTest, Emplace) {
+    structures::LinkedStack<std::string> strings;
+    strings.emplace(3u, 'a');
+    std::string data{"moved"};
+    strings.push(std::move(data));
+    ASSERT_EQ("moved", strings.pop());
+    ASSERT_EQ("aaa", strings.top());
+}
@@ -0,0 +1,112 @@
+// Copyright [2017] <Luiz Motta>
+#include <benchmark/benchmark.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "../array_queue/array_queue.h"
+#include "mpmc_array_queue.h"
+
+/**
+ * Metade das threads produz e metade consome, de 2 ate N threads:
+ * MpmcArrayQueue (bloqueante e em lotes) contra ArrayQueue protegida por
+ * mutex e variaveis de condicao. BM_PingPong mede a latencia de ida e
+ * volta entre duas threads.
+ */
+
+namespace {
+
+constexpr std::size_t CAPACITY = 1u << 12;
+constexpr std::size_t BATCH = 32u;
+
+int max_threads() {
+    auto n = static_cast<int>(std::thread::hardware_concurrency());
+    return n < 2 ? 2 : n;
+}
+
+/*!
+ * \brief ArrayQueue com a interface bloqueante da MpmcArrayQueue.
+ */
+class MutexArrayQueue {
+ public:
+    void wait_enqueue(std::size_t data) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock, [this] { return !queue_.full(); });
+        queue_.enqueue(data);
+        not_empty_.notify_one();
+    }
+
+    std::size_t wait_dequeue() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_empty_.wait(lock, [this] { return !queue_.empty(); });
+        auto data = queue_.dequeue();
+        not_full_.notify_one();
+        return data;
+    }
+
+ private:
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    structures::ArrayQueue<std::size_t, true> queue_{CAPACITY};
+};
+
+structures::MpmcArrayQueue<std::size_t> mpmc_queue{CAPACITY};
+MutexArrayQueue mutex_queue;
+
+structures::MpmcArrayQueue<std::size_t> ping{CAPACITY};
+structures::MpmcArrayQueue<std::size_t> pong{CAPACITY};
+
+}  // namespace
+
+template<typename Queue, Queue& queue>
+static void BM_ProducersConsumers(benchmark::State& state) {
+    // Todas as threads fazem o mesmo numero de iteracoes, entao com um
+    // numero par de threads tudo que eh produzido eh consumido.
+    auto producer = state.thread_index() % 2 == 0;
+    for (auto _ : state) {
+        if (producer)
+            queue.wait_enqueue(state.iterations());
+        else
+            benchmark::DoNotOptimize(queue.wait_dequeue());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_MpmcBulk(benchmark::State& state) {
+    auto producer = state.thread_index() % 2 == 0;
+    std::size_t batch[BATCH] = {};
+    for (auto _ : state) {
+        for (std::size_t done = 0; done < BATCH;) {
+            auto count = producer
+                ? mpmc_queue.enqueue_bulk(batch, BATCH - done)
+                : mpmc_queue.dequeue_bulk(batch, BATCH - done);
+            if (count == 0)
+                std::this_thread::yield();
+            done += count;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH);
+}
+
+static void BM_PingPong(benchmark::State& state) {
+    for (auto _ : state) {
+        if (state.thread_index() == 0) {
+            ping.wait_enqueue(1u);
+            benchmark::DoNotOptimize(pong.wait_dequeue());
+        } else {
+            pong.wait_enqueue(ping.wait_dequeue());
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_ProducersConsumers, decltype(mpmc_queue), mpmc_queue)
+    ->ThreadRange(2, max_threads())->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ProducersConsumers, MutexArrayQueue, mutex_queue)
+    ->ThreadRange(2, max_threads())->UseRealTime();
+BENCHMARK(BM_MpmcBulk)->ThreadRange(2, max_threads())->UseRealTime();
+BENCHMARK(BM_PingPong)->Threads(2)->UseRealTime();
+
+BENCHMARK_MAIN();
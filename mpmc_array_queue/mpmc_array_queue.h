@@ -0,0 +1,548 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_MPMC_ARRAY_QUEUE_H
+#define STRUCTURES_MPMC_ARRAY_QUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#if !defined(__cpp_lib_atomic_wait) && defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace structures {
+
+/*!
+ *  \brief MpmcArrayQueue eh uma fila(FIFO) circular limitada sem locks
+ *  para varios produtores e varios consumidores.
+ *
+ *  Usa o mesmo armazenamento da ArrayQueue (buffer circular nao
+ *  inicializado, capacidade potencia de dois indexada por mascara), com um
+ *  numero de sequencia em cada posicao, como na fila de Dmitry Vyukov: a
+ *  posicao do ticket p esta livre para o produtor quando a sequencia vale
+ *  p e pronta para o consumidor quando vale p + 1. Produtores disputam
+ *  apenas um CAS em _enqueue_pos e consumidores apenas um em
+ *  _dequeue_pos; depois do CAS cada um acessa sua posicao sem disputa.
+ *
+ *  try_* nunca bloqueiam. wait_enqueue e wait_dequeue tentam algumas
+ *  vezes e depois dormem enquanto a fila esta cheia/vazia, num futex (ou
+ *  std::atomic::wait quando disponivel); so quem encontra alguem dormindo
+ *  paga a chamada de sistema para acorda-lo. size(), empty() e full() sao
+ *  aproximados.
+ */
+template<class T>
+class MpmcArrayQueue {
+    static_assert(std::is_nothrow_move_constructible<T>::value,
+                  "MpmcArrayQueue<T> requires a nothrow move constructor");
+
+ public:
+    /*!
+     *  \brief Construtor da fila com tamanho padrao.
+     */
+    MpmcArrayQueue();
+
+    /*!
+     *  \brief Construtor da fila com tamanho desejado.
+     *
+     *  \param max tamanho maximo, arredondado para potencia de dois (no
+     *  minimo 2).
+     */
+    explicit MpmcArrayQueue(std::size_t max);
+
+    MpmcArrayQueue(const MpmcArrayQueue&) = delete;
+
+    MpmcArrayQueue& operator=(const MpmcArrayQueue&) = delete;
+
+    /*!
+     *  \brief Destrutor da fila; nao pode haver outras threads usando-a.
+     */
+    ~MpmcArrayQueue();
+
+    /*!
+     *  \brief enqueue adiciona um elemento ao final da fila.
+     *
+     *  \param data dado a ser armazenado na fila.
+     */
+    void enqueue(const T& data);
+
+    /*!
+     *  \brief dequeue remove o primeiro elemento da fila.
+     *
+     *  \return o primeiro elemento da fila.
+     */
+    T dequeue();
+
+    /*!
+     *  \brief try_enqueue tenta adicionar um elemento ao final da fila.
+     *
+     *  \param data dado a ser armazenado na fila.
+     *
+     *  \return false se a fila estiver cheia.
+     */
+    bool try_enqueue(const T& data);
+
+    /*!
+     *  \brief try_enqueue tenta adicionar um elemento movendo o dado.
+     *
+     *  \param data dado a ser armazenado na fila.
+     *
+     *  \return false se a fila estiver cheia.
+     */
+    bool try_enqueue(T&& data);
+
+    /*!
+     *  \brief try_emplace tenta construir um elemento no final da fila.
+     *
+     *  \param args argumentos repassados ao construtor de T.
+     *
+     *  \return false se a fila estiver cheia.
+     */
+    template<typename... Args>
+    bool try_emplace(Args&&... args);
+
+    /*!
+     *  \brief try_dequeue tenta remover o primeiro elemento da fila.
+     *
+     *  \param data recebe o elemento removido.
+     *
+     *  \return false se a fila estiver vazia.
+     */
+    bool try_dequeue(T& data);
+
+    /*!
+     *  \brief wait_enqueue adiciona um elemento, esperando enquanto a fila
+     *  estiver cheia.
+     *
+     *  \param data dado a ser armazenado na fila.
+     */
+    void wait_enqueue(const T& data);
+
+    /*!
+     *  \brief wait_enqueue adiciona um elemento movendo o dado, esperando
+     *  enquanto a fila estiver cheia.
+     *
+     *  \param data dado a ser armazenado na fila.
+     */
+    void wait_enqueue(T&& data);
+
+    /*!
+     *  \brief wait_dequeue remove o primeiro elemento, esperando enquanto a
+     *  fila estiver vazia.
+     *
+     *  \return o primeiro elemento da fila.
+     */
+    T wait_dequeue();
+
+    /*!
+     *  \brief enqueue_bulk reserva ate count posicoes seguidas com um unico
+     *  CAS e copia os elementos para elas.
+     *
+     *  \param data primeiro dos elementos a copiar.
+     *  \param count quantidade de elementos.
+     *
+     *  \return quantidade de elementos efetivamente adicionados.
+     */
+    std::size_t enqueue_bulk(const T* data, std::size_t count);
+
+    /*!
+     *  \brief dequeue_bulk remove ate count elementos seguidos com um unico
+     *  CAS.
+     *
+     *  \param data destino dos elementos removidos.
+     *  \param count quantidade maxima de elementos.
+     *
+     *  \return quantidade de elementos efetivamente removidos.
+     */
+    std::size_t dequeue_bulk(T* data, std::size_t count);
+
+    /*!
+     *  \brief O metodo size mostra a quantidade aproximada de elementos.
+     *
+     *  \return quantidade de elementos da fila.
+     */
+    std::size_t size() const;
+
+    /*!
+     *  \brief O metodo max_size mostra a capacidade da fila.
+     *
+     *  \return capacidade da fila.
+     */
+    std::size_t max_size() const;
+
+    /*!
+     *  \brief O metodo empty mostra se a fila parece vazia.
+     *
+     *  \return true se a fila estiver vazia.
+     */
+    bool empty() const;
+
+    /*!
+     *  \brief O metodo full mostra se a fila parece cheia.
+     *
+     *  \return true se a fila estiver cheia.
+     */
+    bool full() const;
+
+ private:
+    static constexpr std::size_t CACHE_LINE = 64u;
+
+    /*!
+     *  \brief Posicao do buffer: sequencia e espaco para um elemento.
+     */
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* data() { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    /*!
+     *  \brief Contador de eventos em que threads bloqueadas dormem.
+     */
+    struct Event {
+        std::atomic<std::uint32_t> epoch{0u};
+        std::atomic<std::uint32_t> sleeping{0u};
+    };
+
+    std::size_t claim_enqueue(std::size_t wanted, std::size_t& pos);
+
+    std::size_t claim_dequeue(std::size_t wanted, std::size_t& pos);
+
+    Slot& slot(std::size_t index) const { return contents[index & _mask]; }
+
+    static void announce(Event& event);
+
+    static void notify(Event& event);
+
+    static void wait(Event& event, std::uint32_t epoch);
+
+    static std::size_t round_capacity(std::size_t max);
+
+    Slot* contents;
+    std::size_t _max_size;
+    std::size_t _mask;
+
+    // Linha dos produtores.
+    alignas(CACHE_LINE) std::atomic<std::size_t> _enqueue_pos{0u};
+
+    // Linha dos consumidores.
+    alignas(CACHE_LINE) std::atomic<std::size_t> _dequeue_pos{0u};
+
+    // Fora das linhas acima: sleeping so eh escrito quando alguem dorme.
+    alignas(CACHE_LINE) Event _not_full;
+    alignas(CACHE_LINE) Event _not_empty;
+
+    static const auto DEFAULT_SIZE = 1024u;
+
+    // Tentativas (com yield) antes de dormir no futex.
+    static const auto SPIN = 16u;
+};
+
+template <class T>
+MpmcArrayQueue<T>::MpmcArrayQueue() : MpmcArrayQueue(DEFAULT_SIZE) {}
+
+template <class T>
+MpmcArrayQueue<T>::MpmcArrayQueue(std::size_t max) {
+    _max_size = round_capacity(max);
+    _mask = _max_size - 1;
+    contents = static_cast<Slot*>(::operator new(
+        _max_size * sizeof(Slot), std::align_val_t{alignof(Slot)}));
+    for (std::size_t i = 0; i < _max_size; ++i) {
+        new (&contents[i].sequence) std::atomic<std::size_t>{i};
+    }
+}
+
+template <class T>
+MpmcArrayQueue<T>::~MpmcArrayQueue() {
+    auto tail = _enqueue_pos.load(std::memory_order_relaxed);
+    for (auto i = _dequeue_pos.load(std::memory_order_relaxed); i != tail;
+         ++i) {
+        std::destroy_at(slot(i).data());
+    }
+    ::operator delete(contents, std::align_val_t{alignof(Slot)});
+}
+
+template <class T>
+void MpmcArrayQueue<T>::enqueue(const T& data) {
+    if (!try_enqueue(data))
+        throw std::out_of_range("full MpmcArrayQueue");
+}
+
+template <class T>
+T MpmcArrayQueue<T>::dequeue() {
+    std::size_t pos;
+    if (claim_dequeue(1u, pos) == 0u)
+        throw std::out_of_range("empty MpmcArrayQueue");
+    auto& cell = slot(pos);
+    auto data = std::move(*cell.data());
+    std::destroy_at(cell.data());
+    cell.sequence.store(pos + _max_size, std::memory_order_release);
+    notify(_not_full);
+    return data;
+}
+
+template <class T>
+bool MpmcArrayQueue<T>::try_enqueue(const T& data) {
+    return try_emplace(data);
+}
+
+template <class T>
+bool MpmcArrayQueue<T>::try_enqueue(T&& data) {
+    return try_emplace(std::move(data));
+}
+
+template <class T>
+template <typename... Args>
+bool MpmcArrayQueue<T>::try_emplace(Args&&... args) {
+    if constexpr (!std::is_nothrow_constructible<T, Args&&...>::value) {
+        // Uma posicao reservada tem que ser publicada, entao um construtor
+        // que pode lancar roda antes da reserva.
+        T data(std::forward<Args>(args)...);
+        return try_emplace(std::move(data));
+    }
+    std::size_t pos;
+    if (claim_enqueue(1u, pos) == 0u)
+        return false;
+    auto& cell = slot(pos);
+    new (cell.storage) T(std::forward<Args>(args)...);
+    cell.sequence.store(pos + 1, std::memory_order_release);
+    notify(_not_empty);
+    return true;
+}
+
+template <class T>
+bool MpmcArrayQueue<T>::try_dequeue(T& data) {
+    std::size_t pos;
+    if (claim_dequeue(1u, pos) == 0u)
+        return false;
+    auto& cell = slot(pos);
+    data = std::move(*cell.data());
+    std::destroy_at(cell.data());
+    cell.sequence.store(pos + _max_size, std::memory_order_release);
+    notify(_not_full);
+    return true;
+}
+
+template <class T>
+void MpmcArrayQueue<T>::wait_enqueue(const T& data) {
+    T copy{data};
+    wait_enqueue(std::move(copy));
+}
+
+template <class T>
+void MpmcArrayQueue<T>::wait_enqueue(T&& data) {
+    for (auto spin = 0u; !try_emplace(std::move(data)); ++spin) {
+        if (spin < SPIN) {
+            std::this_thread::yield();
+            continue;
+        }
+        // Le a epoca antes de anunciar a espera: um notify que zere
+        // sleeping depois disso muda a epoca e o wait retorna na hora, e
+        // quem liberar uma posicao depois do anuncio encontra sleeping.
+        auto epoch = _not_full.epoch.load(std::memory_order_seq_cst);
+        announce(_not_full);
+        if (try_emplace(std::move(data)))
+            return;
+        wait(_not_full, epoch);
+    }
+}
+
+template <class T>
+T MpmcArrayQueue<T>::wait_dequeue() {
+    std::size_t pos;
+    for (auto spin = 0u; claim_dequeue(1u, pos) == 0u; ++spin) {
+        if (spin < SPIN) {
+            std::this_thread::yield();
+            continue;
+        }
+        auto epoch = _not_empty.epoch.load(std::memory_order_seq_cst);
+        announce(_not_empty);
+        if (claim_dequeue(1u, pos) != 0u)
+            break;
+        wait(_not_empty, epoch);
+    }
+    auto& cell = slot(pos);
+    auto data = std::move(*cell.data());
+    std::destroy_at(cell.data());
+    cell.sequence.store(pos + _max_size, std::memory_order_release);
+    notify(_not_full);
+    return data;
+}
+
+template <class T>
+std::size_t MpmcArrayQueue<T>::enqueue_bulk(const T* data,
+                                            std::size_t count) {
+    // Com wanted == 0 o claim nunca reserva nada e tentaria para sempre.
+    if (count == 0u)
+        return 0u;
+    std::size_t pos;
+    count = claim_enqueue(count, pos);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto& cell = slot(pos + i);
+        new (cell.storage) T(data[i]);
+        cell.sequence.store(pos + i + 1, std::memory_order_release);
+    }
+    if (count > 0u)
+        notify(_not_empty);
+    return count;
+}
+
+template <class T>
+std::size_t MpmcArrayQueue<T>::dequeue_bulk(T* data, std::size_t count) {
+    if (count == 0u)
+        return 0u;
+    std::size_t pos;
+    count = claim_dequeue(count, pos);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto& cell = slot(pos + i);
+        data[i] = std::move(*cell.data());
+        std::destroy_at(cell.data());
+        cell.sequence.store(pos + i + _max_size, std::memory_order_release);
+    }
+    if (count > 0u)
+        notify(_not_full);
+    return count;
+}
+
+template <class T>
+std::size_t MpmcArrayQueue<T>::size() const {
+    auto head = _dequeue_pos.load(std::memory_order_acquire);
+    auto tail = _enqueue_pos.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0u;
+}
+
+template <class T>
+std::size_t MpmcArrayQueue<T>::max_size() const {
+    return _max_size;
+}
+
+template <class T>
+bool MpmcArrayQueue<T>::empty() const {
+    return size() == 0;
+}
+
+template <class T>
+bool MpmcArrayQueue<T>::full() const {
+    return size() >= _max_size;
+}
+
+template <class T>
+std::size_t MpmcArrayQueue<T>::claim_enqueue(std::size_t wanted,
+                                             std::size_t& pos) {
+    pos = _enqueue_pos.load(std::memory_order_relaxed);
+    for (;;) {
+        // Conta as posicoes livres seguidas a partir de pos.
+        std::size_t ready = 0;
+        while (ready < wanted) {
+            auto sequence = slot(pos + ready).sequence.load(
+                std::memory_order_acquire);
+            if (sequence != pos + ready)
+                break;
+            ++ready;
+        }
+        if (ready == 0u) {
+            auto sequence = slot(pos).sequence.load(
+                std::memory_order_acquire);
+            // Cheia: o consumidor da volta anterior nao liberou a posicao.
+            if (static_cast<std::ptrdiff_t>(sequence - pos) < 0)
+                return 0u;
+            pos = _enqueue_pos.load(std::memory_order_relaxed);
+            continue;
+        }
+        if (_enqueue_pos.compare_exchange_weak(pos, pos + ready,
+                                               std::memory_order_relaxed))
+            return ready;
+    }
+}
+
+template <class T>
+std::size_t MpmcArrayQueue<T>::claim_dequeue(std::size_t wanted,
+                                             std::size_t& pos) {
+    pos = _dequeue_pos.load(std::memory_order_relaxed);
+    for (;;) {
+        // Conta as posicoes prontas seguidas a partir de pos.
+        std::size_t ready = 0;
+        while (ready < wanted) {
+            auto sequence = slot(pos + ready).sequence.load(
+                std::memory_order_acquire);
+            if (sequence != pos + ready + 1)
+                break;
+            ++ready;
+        }
+        if (ready == 0u) {
+            auto sequence = slot(pos).sequence.load(
+                std::memory_order_acquire);
+            // Vazia: o produtor deste ticket ainda nao publicou.
+            if (static_cast<std::ptrdiff_t>(sequence - (pos + 1)) < 0)
+                return 0u;
+            pos = _dequeue_pos.load(std::memory_order_relaxed);
+            continue;
+        }
+        if (_dequeue_pos.compare_exchange_weak(pos, pos + ready,
+                                               std::memory_order_relaxed))
+            return ready;
+    }
+}
+
+template <class T>
+void MpmcArrayQueue<T>::announce(Event& event) {
+    event.sleeping.store(1u, std::memory_order_relaxed);
+    // Pareada com a fence de notify: ou a nova tentativa ve o que foi
+    // publicado, ou notify ve sleeping.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+template <class T>
+void MpmcArrayQueue<T>::notify(Event& event) {
+    // Pareada com a fence de announce: ou a thread que vai dormir ve o
+    // que acabou de ser publicado, ou este load ve sleeping. So quem zera
+    // sleeping acorda, entao cada espera custa uma unica chamada.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (event.sleeping.load(std::memory_order_relaxed) == 0u ||
+        event.sleeping.exchange(0u, std::memory_order_seq_cst) == 0u)
+        return;
+    event.epoch.fetch_add(1u, std::memory_order_seq_cst);
+#if defined(__cpp_lib_atomic_wait)
+    event.epoch.notify_all();
+#elif defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&event.epoch),
+            FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);
+#endif
+}
+
+template <class T>
+void MpmcArrayQueue<T>::wait(Event& event, std::uint32_t epoch) {
+#if defined(__cpp_lib_atomic_wait)
+    event.epoch.wait(epoch, std::memory_order_seq_cst);
+#elif defined(__linux__)
+    static_assert(sizeof(std::atomic<std::uint32_t>) ==
+                  sizeof(std::uint32_t), "futex needs a plain 32-bit word");
+    while (event.epoch.load(std::memory_order_seq_cst) == epoch) {
+        syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&event.epoch),
+                FUTEX_WAIT_PRIVATE, epoch, nullptr, nullptr, 0);
+    }
+#else
+    while (event.epoch.load(std::memory_order_seq_cst) == epoch)
+        std::this_thread::yield();
+#endif
+}
+
+template <class T>
+std::size_t MpmcArrayQueue<T>::round_capacity(std::size_t max) {
+    std::size_t capacity = 2;
+    while (capacity < max)
+        capacity <<= 1;
+    return capacity;
+}
+
+}  // namespace structures
+
+#endif
@@ -0,0 +1,227 @@
+/* Copyright [2017] <Luiz Motta> */
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mpmc_array_queue.h"
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+/**
+ * Teste unitario para fila circular concorrente limitada
+ */
+
+class MpmcArrayQueueTest: public ::testing::Test {
+protected:
+    /**
+     * Fila na qual serao efetuadas as operações
+     */
+    structures::MpmcArrayQueue<int> queue{8u};
+};
+
+TEST_F(MpmcArrayQueueTest, EmptyAndFull) {
+    int data;
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.try_dequeue(data));
+    ASSERT_THROW(queue.dequeue(), std::out_of_range);
+    for (auto i = 0; i < 8; ++i) {
+        ASSERT_TRUE(queue.try_enqueue(i));
+    }
+    ASSERT_TRUE(queue.full());
+    ASSERT_FALSE(queue.try_enqueue(8));
+    ASSERT_THROW(queue.enqueue(8), std::out_of_range);
+    for (auto i = 0; i < 8; ++i) {
+        ASSERT_EQ(i, queue.dequeue());
+    }
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(MpmcArrayQueueTest, Bulk) {
+    int in[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    int out[10] = {};
+    // Zero elementos retorna logo, vazia ou nao.
+    ASSERT_EQ(0u, queue.enqueue_bulk(in, 0));
+    ASSERT_EQ(0u, queue.dequeue_bulk(out, 0));
+    ASSERT_EQ(3u, queue.enqueue_bulk(in, 3));
+    ASSERT_EQ(0u, queue.enqueue_bulk(in, 0));
+    ASSERT_EQ(0u, queue.dequeue_bulk(out, 0));
+    ASSERT_EQ(3u, queue.size());
+    ASSERT_EQ(5u, queue.enqueue_bulk(in + 3, 7));
+    ASSERT_EQ(0u, queue.enqueue_bulk(in, 1));
+    ASSERT_EQ(4u, queue.dequeue_bulk(out, 4));
+    // Da a volta no buffer.
+    ASSERT_EQ(2u, queue.enqueue_bulk(in + 8, 2));
+    ASSERT_EQ(6u, queue.dequeue_bulk(out + 4, 10));
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(i, out[i]);
+    }
+    ASSERT_EQ(0u, queue.dequeue_bulk(out, 10));
+}
+
+TEST_F(MpmcArrayQueueTest, Strings) {
+    structures::MpmcArrayQueue<std::string> strings{2u};
+    strings.wait_enqueue(std::string(64, 'a'));
+    ASSERT_TRUE(strings.try_emplace(3u, 'b'));
+    ASSERT_EQ(std::string(64, 'a'), strings.wait_dequeue());
+    ASSERT_TRUE(strings.try_enqueue(std::string(64, 'c')));
+    // O destrutor destroi "bbb" e a string longa.
+}
+
+/**
+ * Produtores e consumidores bloqueantes numa fila pequena, de modo que os
+ * dois lados dormem: cada valor deve sair exatamente uma vez e, para cada
+ * consumidor, os valores de um mesmo produtor devem sair em ordem.
+ */
+TEST_F(MpmcArrayQueueTest, BlockingProducersAndConsumers) {
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+    constexpr int per_producer = 20000;
+    constexpr int total = producers * per_producer;
+
+    std::vector<std::atomic<int>> seen(total);
+    std::atomic<bool> ordered{true};
+
+    std::vector<std::thread> threads;
+    for (auto p = 0; p < producers; ++p) {
+        threads.emplace_back([this, p] {
+            for (auto i = 0; i < per_producer; ++i) {
+                queue.wait_enqueue(p * per_producer + i);
+            }
+        });
+    }
+    for (auto c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            std::vector<int> last(producers, -1);
+            for (auto i = 0; i < total / consumers; ++i) {
+                auto data = queue.wait_dequeue();
+                auto producer = data / per_producer;
+                if (data <= last[producer])
+                    ordered = false;
+                last[producer] = data;
+                seen[data].fetch_add(1);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_TRUE(ordered);
+    for (auto i = 0; i < total; ++i) {
+        ASSERT_EQ(1, seen[i].load()) << "value " << i;
+    }
+    ASSERT_TRUE(queue.empty());
+}
+
+/**
+ * Consumidores bloqueantes junto com um que so usa try_dequeue: este pode
+ * levar o elemento cujo enqueue acordou os outros, e quem volta a dormir
+ * ainda tem que ser acordado pelos enqueue seguintes.
+ */
+TEST_F(MpmcArrayQueueTest, BlockingAndPollingConsumers) {
+    constexpr int rounds = 300;
+    constexpr int per_round = 4;
+    constexpr int blocking = 3;
+
+    std::atomic<int> consumed{0};
+    std::atomic<bool> poll{false};
+    std::atomic<bool> running{true};
+
+    std::vector<std::thread> threads;
+    for (auto c = 0; c < blocking; ++c) {
+        threads.emplace_back([&] {
+            while (queue.wait_dequeue() >= 0)
+                consumed.fetch_add(1);
+        });
+    }
+    threads.emplace_back([&] {
+        int data;
+        while (running.load()) {
+            if (poll.exchange(false) && queue.try_dequeue(data))
+                consumed.fetch_add(1);
+            std::this_thread::yield();
+        }
+    });
+
+    for (auto round = 0; round < rounds; ++round) {
+        // Os consumidores bloqueantes vao dormir; o primeiro elemento os
+        // acorda, mas pode ser levado pelo try_dequeue antes que eles
+        // tentem de novo, e os seguintes chegam com eles ja esperando.
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        poll = true;
+        ASSERT_TRUE(queue.try_enqueue(0));
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+        for (auto i = 1; i < per_round; ++i) {
+            ASSERT_TRUE(queue.try_enqueue(i));
+        }
+        auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::seconds(10);
+        while (consumed.load() < (round + 1) * per_round &&
+               std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+        // Se falhar, os consumidores ficaram dormindo com a fila cheia.
+        ASSERT_EQ((round + 1) * per_round, consumed.load())
+            << "round " << round << ", size " << queue.size();
+    }
+
+    running = false;
+    for (auto c = 0; c < blocking; ++c) {
+        queue.wait_enqueue(-1);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(MpmcArrayQueueTest, BulkProducersAndConsumers) {
+    constexpr int producers = 3;
+    constexpr int per_producer = 30000;
+    constexpr int total = producers * per_producer;
+
+    std::vector<std::atomic<int>> seen(total);
+    std::atomic<int> consumed{0};
+
+    std::vector<std::thread> threads;
+    for (auto p = 0; p < producers; ++p) {
+        threads.emplace_back([this, p] {
+            int batch[5];
+            for (auto i = 0; i < per_producer;) {
+                auto count = per_producer - i < 5 ? per_producer - i : 5;
+                for (auto j = 0; j < count; ++j) {
+                    batch[j] = p * per_producer + i + j;
+                }
+                auto sent = static_cast<int>(queue.enqueue_bulk(batch, count));
+                if (sent == 0)
+                    std::this_thread::yield();
+                i += sent;
+            }
+        });
+    }
+    for (auto c = 0; c < 2; ++c) {
+        threads.emplace_back([&] {
+            int batch[3];
+            while (consumed.load() < total) {
+                auto received = queue.dequeue_bulk(batch, 3);
+                if (received == 0)
+                    std::this_thread::yield();
+                for (auto i = 0u; i < received; ++i) {
+                    seen[batch[i]].fetch_add(1);
+                }
+                consumed.fetch_add(static_cast<int>(received));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto i = 0; i < total; ++i) {
+        ASSERT_EQ(1, seen[i].load()) << "value " << i;
+    }
+}
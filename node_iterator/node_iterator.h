@@ -0,0 +1,150 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_NODE_ITERATOR_H
+#define STRUCTURES_NODE_ITERATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace structures {
+
+/*!
+ *  \brief Iterador de avanco sobre Nodes com next() e data().
+ *
+ *  Guarda a posicao junto com o Node, e dois iteradores sao iguais quando
+ *  estao na mesma posicao; assim o mesmo iterador serve para as listas
+ *  lineares (end() em nullptr) e circulares (end() volta ao head).
+ *
+ *  U eh T ou const T e N eh Node ou const Node.
+ */
+template<typename U, typename N>
+class ForwardNodeIterator {
+ public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename std::remove_const<U>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = U*;
+    using reference = U&;
+
+    ForwardNodeIterator() = default;
+
+    ForwardNodeIterator(N* node, std::size_t index):
+        node_{node}, index_{index} {}
+
+    /*!
+     *  \brief Converte iterator em const_iterator.
+     */
+    template<typename V, typename M, typename = typename std::enable_if<
+        std::is_convertible<M*, N*>::value>::type>
+    ForwardNodeIterator(const ForwardNodeIterator<V, M>& other):  // NOLINT
+        node_{other.node_}, index_{other.index_} {}
+
+    reference operator*() const { return node_->data(); }
+
+    pointer operator->() const { return &node_->data(); }
+
+    ForwardNodeIterator& operator++() {
+        node_ = node_->next();
+        ++index_;
+        return *this;
+    }
+
+    ForwardNodeIterator operator++(int) {
+        auto old = *this;
+        ++*this;
+        return old;
+    }
+
+    bool operator==(const ForwardNodeIterator& other) const {
+        return index_ == other.index_;
+    }
+
+    bool operator!=(const ForwardNodeIterator& other) const {
+        return index_ != other.index_;
+    }
+
+ private:
+    template<typename, typename> friend class ForwardNodeIterator;
+
+    N* node_{nullptr};
+    std::size_t index_{0u};
+};
+
+/*!
+ *  \brief Iterador bidirecional sobre Nodes com prev(), next() e data().
+ *
+ *  Alem da posicao guarda o ultimo Node da lista, usado para voltar de
+ *  end() quando ele aponta para nullptr. Inserir no final invalida end().
+ */
+template<typename U, typename N>
+class BidirectionalNodeIterator {
+ public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename std::remove_const<U>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = U*;
+    using reference = U&;
+
+    BidirectionalNodeIterator() = default;
+
+    BidirectionalNodeIterator(N* node, N* last, std::size_t index):
+        node_{node}, last_{last}, index_{index} {}
+
+    /*!
+     *  \brief Converte iterator em const_iterator.
+     */
+    template<typename V, typename M, typename = typename std::enable_if<
+        std::is_convertible<M*, N*>::value>::type>
+    BidirectionalNodeIterator(  // NOLINT
+        const BidirectionalNodeIterator<V, M>& other):
+        node_{other.node_}, last_{other.last_}, index_{other.index_} {}
+
+    reference operator*() const { return node_->data(); }
+
+    pointer operator->() const { return &node_->data(); }
+
+    BidirectionalNodeIterator& operator++() {
+        node_ = node_->next();
+        ++index_;
+        return *this;
+    }
+
+    BidirectionalNodeIterator operator++(int) {
+        auto old = *this;
+        ++*this;
+        return old;
+    }
+
+    BidirectionalNodeIterator& operator--() {
+        node_ = node_ == nullptr ? last_ : node_->prev();
+        --index_;
+        return *this;
+    }
+
+    BidirectionalNodeIterator operator--(int) {
+        auto old = *this;
+        --*this;
+        return old;
+    }
+
+    bool operator==(const BidirectionalNodeIterator& other) const {
+        return index_ == other.index_;
+    }
+
+    bool operator!=(const BidirectionalNodeIterator& other) const {
+        return index_ != other.index_;
+    }
+
+ private:
+    template<typename, typename> friend class BidirectionalNodeIterator;
+
+    N* node_{nullptr};
+    N* last_{nullptr};
+    std::size_t index_{0u};
+};
+
+}  // namespace structures
+
+#endif
@@ -0,0 +1,58 @@
+// Copyright [2017] <Luiz Motta>
+#include "benchmark/benchmark.h"
+#include "../linked_queue/linked_queue.h"
+#include "../linked_stack/linked_stack.h"
+#include "node_pool.h"
+
+/**
+ * Compara push/pop dos containers encadeados usando o heap global e os
+ * pools de Nodes.
+ */
+
+template<typename Alloc>
+static void BM_LinkedStackPushPop(benchmark::State& state) {
+    structures::LinkedStack<int, Alloc> stack;
+    auto n = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        for (auto i = 0; i < n; ++i) {
+            stack.push(i);
+        }
+        while (!stack.empty()) {
+            benchmark::DoNotOptimize(stack.pop());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n * 2);
+}
+
+template<typename Alloc>
+static void BM_LinkedQueueEnqueueDequeue(benchmark::State& state) {
+    structures::LinkedQueue<int, Alloc> queue;
+    auto n = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        for (auto i = 0; i < n; ++i) {
+            queue.enqueue(i);
+        }
+        while (!queue.empty()) {
+            benchmark::DoNotOptimize(queue.dequeue());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n * 2);
+}
+
+BENCHMARK_TEMPLATE(BM_LinkedStackPushPop, structures::HeapAllocator)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_LinkedStackPushPop, structures::PoolAllocator)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_LinkedStackPushPop,
+                   structures::ThreadLocalPoolAllocator)
+    ->Range(1 << 10, 1 << 20);
+
+BENCHMARK_TEMPLATE(BM_LinkedQueueEnqueueDequeue, structures::HeapAllocator)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_LinkedQueueEnqueueDequeue, structures::PoolAllocator)
+    ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_LinkedQueueEnqueueDequeue,
+                   structures::ThreadLocalPoolAllocator)
+    ->Range(1 << 10, 1 << 20);
+
+BENCHMARK_MAIN();
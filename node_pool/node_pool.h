@@ -0,0 +1,255 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_NODE_POOL_H
+#define STRUCTURES_NODE_POOL_H
+
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace structures {
+
+/*!
+ *  \brief NodePool eh um alocador de blocos de tamanho fixo (slab).
+ *
+ *  Os blocos sao reservados em chunks alinhados a linha de cache e os
+ *  blocos liberados voltam para uma free list, sendo reaproveitados pela
+ *  proxima alocacao. A memoria dos chunks so eh devolvida ao sistema na
+ *  destruicao do pool.
+ */
+template<std::size_t Size, std::size_t Align>
+class NodePool {
+ public:
+    /*!
+     *  \brief Construtor do pool vazio.
+     */
+    NodePool() = default;
+
+    NodePool(const NodePool&) = delete;
+
+    NodePool& operator=(const NodePool&) = delete;
+
+    /*!
+     *  \brief Construtor de movimento, assume os chunks de other.
+     */
+    NodePool(NodePool&& other) noexcept;
+
+    /*!
+     *  \brief Libera os chunks atuais e assume os de other.
+     */
+    NodePool& operator=(NodePool&& other) noexcept;
+
+    /*!
+     *  \brief Destrutor, libera todos os chunks.
+     */
+    ~NodePool();
+
+    /*!
+     *  \brief Reserva um bloco de Size bytes alinhado a Align.
+     *
+     *  \return ponteiro para o bloco nao inicializado.
+     */
+    void* allocate();
+
+    /*!
+     *  \brief Devolve um bloco ao pool.
+     *
+     *  \param block bloco obtido por allocate().
+     */
+    void deallocate(void* block);
+
+ private:
+    union Slot {
+        Slot* next;
+        alignas(Align) unsigned char storage[Size];
+    };
+
+    struct Chunk {
+        Chunk* next;
+    };
+
+    static constexpr std::size_t CACHE_LINE = 64u;
+    static constexpr std::size_t CHUNK_ALIGN =
+        alignof(Slot) > CACHE_LINE ? alignof(Slot) : CACHE_LINE;
+    static constexpr std::size_t HEADER_SIZE = CHUNK_ALIGN;
+    static constexpr std::size_t CHUNK_SIZE = 16u * 1024u;
+    static constexpr std::size_t SLOTS_PER_CHUNK =
+        (CHUNK_SIZE - HEADER_SIZE) / sizeof(Slot) > 0 ?
+        (CHUNK_SIZE - HEADER_SIZE) / sizeof(Slot) : 1u;
+
+    void new_chunk();
+
+    void release();
+
+    Slot* free_{nullptr};
+    Slot* bump_{nullptr};
+    Slot* bump_end_{nullptr};
+    Chunk* chunks_{nullptr};
+};
+
+/*
+ * Cada politica expoe rebind<Node>::is_always_equal, verdadeiro quando um
+ * Node criado por um container pode ser destruido por outro (o que
+ * permite transferir Nodes entre containers sem copiar os dados).
+ */
+
+/*!
+ *  \brief Politica de alocacao que usa o heap global para cada Node.
+ */
+struct HeapAllocator {
+    template<typename Node>
+    class rebind {
+     public:
+        using is_always_equal = std::true_type;
+
+        template<typename... Args>
+        Node* create(Args&&... args) {
+            return new Node(std::forward<Args>(args)...);
+        }
+
+        void destroy(Node* node) { delete node; }
+    };
+};
+
+/*!
+ *  \brief Politica de alocacao em que cada container tem seu NodePool.
+ *
+ *  Uma copia do container comeca com um pool vazio; mover o container move
+ *  o pool junto com os Nodes.
+ */
+struct PoolAllocator {
+    template<typename Node>
+    class rebind {
+     public:
+        using is_always_equal = std::false_type;
+
+        rebind() = default;
+
+        rebind(const rebind&) {}
+
+        rebind(rebind&&) noexcept = default;
+
+        rebind& operator=(const rebind&) { return *this; }
+
+        rebind& operator=(rebind&&) noexcept = default;
+
+        template<typename... Args>
+        Node* create(Args&&... args) {
+            return new (pool_.allocate()) Node(std::forward<Args>(args)...);
+        }
+
+        void destroy(Node* node) {
+            node->~Node();
+            pool_.deallocate(node);
+        }
+
+     private:
+        NodePool<sizeof(Node), alignof(Node)> pool_;
+    };
+};
+
+/*!
+ *  \brief Politica de alocacao com um NodePool por thread, compartilhado
+ *  por todos os containers com Nodes do mesmo tamanho.
+ *
+ *  Cada Node deve ser destruido na mesma thread que o criou: um Node
+ *  devolvido a outra thread iria para a free list dela enquanto o chunk
+ *  continua sendo do pool da thread original, que o libera quando
+ *  termina. Por isso o container nao deve ser usado, movido nem destruido
+ *  fora da thread que o criou, e is_always_equal eh falso para que
+ *  append entre containers copie os dados em vez de transferir Nodes.
+ */
+struct ThreadLocalPoolAllocator {
+    template<typename Node>
+    class rebind {
+     public:
+        using is_always_equal = std::false_type;
+
+        template<typename... Args>
+        Node* create(Args&&... args) {
+            return new (pool().allocate()) Node(std::forward<Args>(args)...);
+        }
+
+        void destroy(Node* node) {
+            node->~Node();
+            pool().deallocate(node);
+        }
+
+     private:
+        static NodePool<sizeof(Node), alignof(Node)>& pool() {
+            thread_local NodePool<sizeof(Node), alignof(Node)> pool_;
+            return pool_;
+        }
+    };
+};
+
+template<std::size_t Size, std::size_t Align>
+NodePool<Size, Align>::NodePool(NodePool&& other) noexcept :
+    free_{std::exchange(other.free_, nullptr)},
+    bump_{std::exchange(other.bump_, nullptr)},
+    bump_end_{std::exchange(other.bump_end_, nullptr)},
+    chunks_{std::exchange(other.chunks_, nullptr)}
+{}
+
+template<std::size_t Size, std::size_t Align>
+NodePool<Size, Align>& NodePool<Size, Align>::operator=(
+    NodePool&& other) noexcept {
+    if (this != &other) {
+        release();
+        free_ = std::exchange(other.free_, nullptr);
+        bump_ = std::exchange(other.bump_, nullptr);
+        bump_end_ = std::exchange(other.bump_end_, nullptr);
+        chunks_ = std::exchange(other.chunks_, nullptr);
+    }
+    return *this;
+}
+
+template<std::size_t Size, std::size_t Align>
+NodePool<Size, Align>::~NodePool() {
+    release();
+}
+
+template<std::size_t Size, std::size_t Align>
+void* NodePool<Size, Align>::allocate() {
+    if (free_ != nullptr) {
+        auto slot = free_;
+        free_ = free_->next;
+        return slot;
+    }
+    if (bump_ == bump_end_)
+        new_chunk();
+    return bump_++;
+}
+
+template<std::size_t Size, std::size_t Align>
+void NodePool<Size, Align>::deallocate(void* block) {
+    auto slot = static_cast<Slot*>(block);
+    slot->next = free_;
+    free_ = slot;
+}
+
+template<std::size_t Size, std::size_t Align>
+void NodePool<Size, Align>::release() {
+    while (chunks_ != nullptr) {
+        auto to_delete = chunks_;
+        chunks_ = chunks_->next;
+        ::operator delete(to_delete, std::align_val_t{CHUNK_ALIGN});
+    }
+    free_ = bump_ = bump_end_ = nullptr;
+}
+
+template<std::size_t Size, std::size_t Align>
+void NodePool<Size, Align>::new_chunk() {
+    auto bytes = HEADER_SIZE + SLOTS_PER_CHUNK * sizeof(Slot);
+    auto memory = static_cast<unsigned char*>(
+        ::operator new(bytes, std::align_val_t{CHUNK_ALIGN}));
+    auto chunk = new (memory) Chunk{chunks_};
+    chunks_ = chunk;
+    bump_ = reinterpret_cast<Slot*>(memory + HEADER_SIZE);
+    bump_end_ = bump_ + SLOTS_PER_CHUNK;
+}
+
+}  // namespace structures
+
+#endif
@@ -0,0 +1,106 @@
+// Copyright [2017] <Luiz Motta>
+#include <chrono>
+#include <cstdint>
+
+#include "benchmark/benchmark.h"
+#include "../array_list/array_list.h"
+#include "../linked_stack/linked_stack.h"
+#include "segmented_array_stack.h"
+
+/**
+ * Pilhas que crescem sem limite numa busca em profundidade: a ArrayList
+ * com fator de crescimento (realoca e move tudo ao dobrar), a LinkedStack
+ * (um Node por elemento) e a SegmentedArrayStack.
+ */
+
+namespace {
+
+/*!
+ * \brief ArrayList usada como pilha, dobrando a capacidade quando enche.
+ */
+class GrowingStack {
+ public:
+    void push(int data) { list_.push_back(data); }
+
+    int pop() { return list_.pop_back(); }
+
+    bool empty() const { return list_.empty(); }
+
+ private:
+    structures::ArrayList<int> list_{16u, 2.0};
+};
+
+}  // namespace
+
+template<typename Stack>
+static void BM_DeepPushPop(benchmark::State& state) {
+    auto n = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        Stack stack;
+        for (auto i = 0; i < n; ++i) {
+            stack.push(i);
+        }
+        while (!stack.empty()) {
+            benchmark::DoNotOptimize(stack.pop());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n * 2);
+}
+
+/*!
+ * \brief Mede cada push e reporta o pior, onde a ArrayList realoca.
+ */
+template<typename Stack>
+static void BM_WorstPush(benchmark::State& state) {
+    using clock = std::chrono::steady_clock;
+    auto n = static_cast<int>(state.range(0));
+    clock::duration worst{};
+    for (auto _ : state) {
+        Stack stack;
+        for (auto i = 0; i < n; ++i) {
+            auto start = clock::now();
+            stack.push(i);
+            auto elapsed = clock::now() - start;
+            if (elapsed > worst)
+                worst = elapsed;
+        }
+    }
+    state.counters["worst_push_ns"] = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(worst).count());
+}
+
+/*!
+ * \brief push/pop alternando na fronteira de um bloco.
+ */
+static void BM_SegmentedBoundary(benchmark::State& state) {
+    structures::SegmentedArrayStack<int> stack;
+    auto block = static_cast<int>(structures::segmented_capacity<int>());
+    for (auto i = 0; i < block; ++i) {
+        stack.push(i);
+    }
+    for (auto _ : state) {
+        stack.push(0);
+        benchmark::DoNotOptimize(stack.pop());
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+BENCHMARK(BM_SegmentedBoundary);
+
+// A LinkedStack fica por ultimo: os milhoes de Nodes que ela libera fazem
+// o proximo malloc grande consolidar o heap, o que apareceria como pior
+// push do benchmark seguinte.
+BENCHMARK_TEMPLATE(BM_DeepPushPop, GrowingStack)->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_DeepPushPop, structures::SegmentedArrayStack<int>)
+    ->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_WorstPush, GrowingStack)
+    ->Arg(1 << 24)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_WorstPush, structures::SegmentedArrayStack<int>)
+    ->Arg(1 << 24)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_DeepPushPop, structures::LinkedStack<int>)
+    ->Range(1 << 10, 1 << 24);
+BENCHMARK_TEMPLATE(BM_WorstPush, structures::LinkedStack<int>)
+    ->Arg(1 << 24)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
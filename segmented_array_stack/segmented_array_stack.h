@@ -0,0 +1,507 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_SEGMENTED_ARRAY_STACK_H
+#define STRUCTURES_SEGMENTED_ARRAY_STACK_H
+
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../node_pool/node_pool.h"
+
+namespace structures {
+
+/*!
+ * \brief Quantos elementos cabem num bloco de cerca de 4KiB (no minimo 16).
+ */
+template<typename T>
+constexpr std::size_t segmented_capacity() {
+    constexpr std::size_t bytes = 4096u - 2u * sizeof(void*);
+    return bytes / sizeof(T) > 16u ? bytes / sizeof(T) : 16u;
+}
+
+/*!
+ * \brief Pilha em segmentos: um vetor de blocos de N elementos ligados do
+ * fundo para o topo.
+ *
+ * Ao contrario da ArrayStack nao tem tamanho maximo: quando o bloco do
+ * topo enche, push liga um bloco novo em vez de realocar a pilha, entao
+ * nenhum elemento eh copiado e referencias para os elementos continuam
+ * validas ate eles serem retirados. O ultimo bloco esvaziado por pop
+ * fica de reserva, e push/pop alternando na fronteira de um bloco nao
+ * alocam nem liberam memoria.
+ */
+template<typename T, typename Alloc = HeapAllocator,
+         std::size_t N = segmented_capacity<T>()>
+class SegmentedArrayStack {
+    class Block;
+
+ public:
+    /*!
+     * \brief Iterador do fundo para o topo da pilha, como na ArrayStack.
+     *
+     * U eh T ou const T e M eh Block ou const Block.
+     */
+    template<typename U, typename M>
+    class Iterator {
+     public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = U*;
+        using reference = U&;
+
+        Iterator() = default;
+
+        Iterator(M* block, std::size_t index):
+            block_{block}, index_{index} {}
+
+        template<typename V, typename L, typename = typename std::enable_if<
+            std::is_convertible<L*, M*>::value>::type>
+        Iterator(const Iterator<V, L>& other):  // NOLINT
+            block_{other.block_}, offset_{other.offset_},
+            index_{other.index_} {}
+
+        reference operator*() const { return block_->data()[offset_]; }
+
+        pointer operator->() const { return block_->data() + offset_; }
+
+        Iterator& operator++() {
+            if (++offset_ == N) {
+                block_ = block_->next();
+                offset_ = 0u;
+            }
+            ++index_;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return index_ == other.index_;
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return index_ != other.index_;
+        }
+
+     private:
+        template<typename, typename> friend class Iterator;
+
+        M* block_{nullptr};
+        std::size_t offset_{0u};
+        std::size_t index_{0u};
+    };
+
+    using value_type = T;
+    using iterator = Iterator<T, Block>;
+    using const_iterator = Iterator<const T, const Block>;
+
+    /*!
+     * \brief Construtor da pilha vazia
+     */
+    SegmentedArrayStack() = default;
+
+    /*!
+     * \brief Construtor de copia, copia todos os elementos de other
+     */
+    SegmentedArrayStack(const SegmentedArrayStack& other);
+
+    /*!
+     * \brief Construtor de movimento, assume os blocos de other sem alocar
+     */
+    SegmentedArrayStack(SegmentedArrayStack&& other) noexcept;
+
+    /*!
+     * \brief Atribuicao por copia
+     */
+    SegmentedArrayStack& operator=(const SegmentedArrayStack& other);
+
+    /*!
+     * \brief Atribuicao por movimento
+     */
+    SegmentedArrayStack& operator=(SegmentedArrayStack&& other) noexcept;
+
+    /*!
+     * \brief Destrutor
+     */
+    ~SegmentedArrayStack();
+
+    /*!
+     * \brief Troca o conteudo com outra pilha em O(1)
+     */
+    void swap(SegmentedArrayStack& other) noexcept;
+
+    /*!
+     * \brief Remove todos os elementos e libera todos os blocos
+     */
+    void clear();
+
+    /*!
+     * \brief Coloca um elemento no topo da pilha
+     *
+     * \param data, dado a ser armazenado
+     */
+    void push(const T& data);
+
+    /*!
+     * \brief Coloca um elemento no topo da pilha, movendo o dado
+     *
+     * \param data, dado a ser armazenado
+     */
+    void push(T&& data);
+
+    /*!
+     * \brief Constroi um elemento no topo da pilha
+     *
+     * \param args, argumentos repassados ao construtor de T
+     *
+     * \return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace(Args&&... args);
+
+    /*!
+     * \brief Retira o elemento do topo da pilha
+     *
+     * \return o dado que estava no topo
+     */
+    T pop();
+
+    /*!
+     * \brief Passa a referencia do dado do topo da pilha
+     *
+     * \return referencia do dado do topo
+     */
+    T& top();
+
+    /*!
+     * \brief Passa a referencia constante do dado do topo da pilha
+     *
+     * \return referencia constante do dado do topo
+     */
+    const T& top() const;
+
+    /*!
+     * \brief Verifica se a pilha esta vazia
+     *
+     * \return true caso a pilha esteja vazia, caso contrario false
+     */
+    bool empty() const;
+
+    /*!
+     * \brief Passa o tamanho da pilha
+     *
+     * \return tamanho da pilha
+     */
+    std::size_t size() const;
+
+    /*!
+     * \brief Iterador para o elemento do fundo
+     *
+     * \return iterador para o elemento do fundo
+     */
+    iterator begin();
+
+    /*!
+     * \brief Iterador constante para o elemento do fundo
+     *
+     * \return iterador constante para o elemento do fundo
+     */
+    const_iterator begin() const;
+
+    /*!
+     * \brief Iterador constante para o elemento do fundo
+     *
+     * \return iterador constante para o elemento do fundo
+     */
+    const_iterator cbegin() const;
+
+    /*!
+     * \brief Iterador para depois do topo
+     *
+     * \return iterador para o fim
+     */
+    iterator end();
+
+    /*!
+     * \brief Iterador constante para depois do topo
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator end() const;
+
+    /*!
+     * \brief Iterador constante para depois do topo
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator cend() const;
+
+ private:
+    /*!
+     * \brief Espaco para N elementos; todos os blocos abaixo do topo estao
+     * cheios e o topo tem last_ elementos.
+     */
+    class Block {
+     public:
+        // Nao eh "= default" para que new Block() nao zere storage_.
+        Block() {}
+
+        Block(const Block&) = delete;
+
+        Block& operator=(const Block&) = delete;
+
+        T* data() { return std::launder(reinterpret_cast<T*>(storage_)); }
+
+        const T* data() const {
+            return std::launder(reinterpret_cast<const T*>(storage_));
+        }
+
+        Block* prev() { return prev_; }
+
+        void prev(Block* block) { prev_ = block; }
+
+        Block* next() { return next_; }
+
+        const Block* next() const { return next_; }
+
+        void next(Block* block) { next_ = block; }
+
+     private:
+        Block* prev_{nullptr};
+        Block* next_{nullptr};
+        alignas(T) unsigned char storage_[N * sizeof(T)];
+    };
+
+    Block* acquire();
+
+    void recycle(Block* block);
+
+    typename Alloc::template rebind<Block> alloc_;
+    Block* head{nullptr};
+    Block* tail{nullptr};
+    Block* spare{nullptr};
+    std::size_t last_{0u};
+    std::size_t size_{0u};
+};
+
+    template<typename T, typename Alloc, std::size_t N>
+    SegmentedArrayStack<T, Alloc, N>::SegmentedArrayStack(
+        const SegmentedArrayStack& other) :
+        alloc_{other.alloc_}
+    {
+        try {
+            for (auto& data : other)
+                push(data);
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    SegmentedArrayStack<T, Alloc, N>::SegmentedArrayStack(
+        SegmentedArrayStack&& other) noexcept :
+        alloc_{std::move(other.alloc_)},
+        head{std::exchange(other.head, nullptr)},
+        tail{std::exchange(other.tail, nullptr)},
+        spare{std::exchange(other.spare, nullptr)},
+        last_{std::exchange(other.last_, 0u)},
+        size_{std::exchange(other.size_, 0u)}
+    {}
+
+    template<typename T, typename Alloc, std::size_t N>
+    SegmentedArrayStack<T, Alloc, N>&
+    SegmentedArrayStack<T, Alloc, N>::operator=(
+        const SegmentedArrayStack& other) {
+        if (this != &other) {
+            SegmentedArrayStack copy{other};
+            swap(copy);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    SegmentedArrayStack<T, Alloc, N>&
+    SegmentedArrayStack<T, Alloc, N>::operator=(
+        SegmentedArrayStack&& other) noexcept {
+        if (this != &other) {
+            SegmentedArrayStack moved{std::move(other)};
+            swap(moved);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    SegmentedArrayStack<T, Alloc, N>::~SegmentedArrayStack() { clear(); }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void SegmentedArrayStack<T, Alloc, N>::swap(
+        SegmentedArrayStack& other) noexcept {
+        std::swap(alloc_, other.alloc_);
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(spare, other.spare);
+        std::swap(last_, other.last_);
+        std::swap(size_, other.size_);
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void SegmentedArrayStack<T, Alloc, N>::clear() {
+        while (head != nullptr) {
+            auto end = head == tail ? last_ : N;
+            std::destroy(head->data(), head->data() + end);
+            alloc_.destroy(std::exchange(head, head->next()));
+        }
+        if (spare != nullptr)
+            alloc_.destroy(std::exchange(spare, nullptr));
+        tail = nullptr;
+        last_ = 0u;
+        size_ = 0u;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void SegmentedArrayStack<T, Alloc, N>::push(const T& data) {
+        emplace(data);
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void SegmentedArrayStack<T, Alloc, N>::push(T&& data) {
+        emplace(std::move(data));
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    template<typename... Args>
+    T& SegmentedArrayStack<T, Alloc, N>::emplace(Args&&... args) {
+        if (tail != nullptr && last_ < N) {
+            new (tail->data() + last_) T(std::forward<Args>(args)...);
+        } else {
+            // So liga o bloco novo depois que o elemento foi construido.
+            auto block = acquire();
+            try {
+                new (block->data()) T(std::forward<Args>(args)...);
+            } catch (...) {
+                recycle(block);
+                throw;
+            }
+            block->prev(tail);
+            if (tail == nullptr)
+                head = block;
+            else
+                tail->next(block);
+            tail = block;
+            last_ = 0u;
+        }
+        ++size_;
+        return tail->data()[last_++];
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    T SegmentedArrayStack<T, Alloc, N>::pop() {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        auto slot = tail->data() + last_ - 1u;
+        auto data = std::move(*slot);
+        std::destroy_at(slot);
+        --last_;
+        --size_;
+        if (last_ == 0u && tail != head) {
+            auto emptied = tail;
+            tail = tail->prev();
+            tail->next(nullptr);
+            recycle(emptied);
+            last_ = N;
+        }
+        return data;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    T& SegmentedArrayStack<T, Alloc, N>::top() {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        return tail->data()[last_ - 1u];
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    const T& SegmentedArrayStack<T, Alloc, N>::top() const {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        return tail->data()[last_ - 1u];
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    bool SegmentedArrayStack<T, Alloc, N>::empty() const {
+        return size() == 0u;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    std::size_t SegmentedArrayStack<T, Alloc, N>::size() const {
+        return size_;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename SegmentedArrayStack<T, Alloc, N>::iterator
+    SegmentedArrayStack<T, Alloc, N>::begin() {
+        return iterator{head, 0u};
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename SegmentedArrayStack<T, Alloc, N>::const_iterator
+    SegmentedArrayStack<T, Alloc, N>::begin() const {
+        return const_iterator{head, 0u};
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename SegmentedArrayStack<T, Alloc, N>::const_iterator
+    SegmentedArrayStack<T, Alloc, N>::cbegin() const {
+        return begin();
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename SegmentedArrayStack<T, Alloc, N>::iterator
+    SegmentedArrayStack<T, Alloc, N>::end() {
+        return iterator{nullptr, size_};
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename SegmentedArrayStack<T, Alloc, N>::const_iterator
+    SegmentedArrayStack<T, Alloc, N>::end() const {
+        return const_iterator{nullptr, size_};
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename SegmentedArrayStack<T, Alloc, N>::const_iterator
+    SegmentedArrayStack<T, Alloc, N>::cend() const {
+        return end();
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename SegmentedArrayStack<T, Alloc, N>::Block*
+    SegmentedArrayStack<T, Alloc, N>::acquire() {
+        if (spare == nullptr)
+            return alloc_.create();
+        return std::exchange(spare, nullptr);
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void SegmentedArrayStack<T, Alloc, N>::recycle(Block* block) {
+        // Guarda so um bloco de reserva; o anterior volta ao alocador.
+        if (spare != nullptr)
+            alloc_.destroy(spare);
+        block->prev(nullptr);
+        block->next(nullptr);
+        spare = block;
+    }
+
+}  // namespace structures
+
+#endif
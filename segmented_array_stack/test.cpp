@@ -0,0 +1,186 @@
+/* Copyright [2017] <Luiz Motta> */
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "segmented_array_stack.h"
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+/**
+ * Teste unitario para pilha em segmentos, com blocos de 4 elementos
+ */
+
+/**
+ * Politica de alocacao que conta os blocos criados e os ainda vivos
+ */
+struct CountingAllocator {
+    inline static std::size_t created = 0u;
+    inline static std::size_t live = 0u;
+
+    template<typename Node>
+    class rebind {
+     public:
+        using is_always_equal = std::true_type;
+
+        template<typename... Args>
+        Node* create(Args&&... args) {
+            ++created;
+            ++live;
+            return new Node(std::forward<Args>(args)...);
+        }
+
+        void destroy(Node* node) {
+            --live;
+            delete node;
+        }
+    };
+};
+
+class SegmentedArrayStackTest: public ::testing::Test {
+protected:
+    using Stack = structures::SegmentedArrayStack<int, CountingAllocator, 4u>;
+
+    void SetUp() override {
+        CountingAllocator::created = 0u;
+        CountingAllocator::live = 0u;
+    }
+
+    /**
+     * Elementos da pilha, do fundo para o topo
+     */
+    template<typename S>
+    static auto values(const S& stack) {
+        std::vector<typename S::value_type> result;
+        for (const auto& data : stack) {
+            result.push_back(data);
+        }
+        EXPECT_EQ(result.size(), stack.size());
+        return result;
+    }
+
+    /**
+     * Pilha na qual serao efetuadas as operações
+     */
+    Stack stack;
+};
+
+TEST_F(SegmentedArrayStackTest, PushAndPop) {
+    ASSERT_TRUE(stack.empty());
+    ASSERT_THROW(stack.pop(), std::out_of_range);
+    ASSERT_THROW(stack.top(), std::out_of_range);
+    for (auto i = 0; i < 10; ++i) {
+        stack.push(i);
+        ASSERT_EQ(i, stack.top());
+    }
+    ASSERT_EQ(3u, CountingAllocator::created);
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}),
+              values(stack));
+    for (auto i = 10; i-- > 0;) {
+        ASSERT_EQ(i, stack.top());
+        ASSERT_EQ(i, stack.pop());
+    }
+    ASSERT_TRUE(stack.empty());
+    ASSERT_THROW(stack.pop(), std::out_of_range);
+}
+
+/**
+ * push/pop alternando na fronteira de um bloco usam o bloco de reserva:
+ * nenhuma alocacao nem liberacao depois do primeiro ciclo.
+ */
+TEST_F(SegmentedArrayStackTest, HotSpareAtBoundary) {
+    for (auto i = 0; i < 4; ++i) {
+        stack.push(i);
+    }
+    ASSERT_EQ(1u, CountingAllocator::created);
+    for (auto round = 0; round < 100; ++round) {
+        stack.push(4);
+        ASSERT_EQ(4, stack.pop());
+        ASSERT_EQ(3, stack.top());
+    }
+    ASSERT_EQ(2u, CountingAllocator::created);
+    ASSERT_EQ(2u, CountingAllocator::live);
+
+    // So um bloco fica de reserva; o anterior volta ao alocador.
+    for (auto i = 4; i < 12; ++i) {
+        stack.push(i);
+    }
+    ASSERT_EQ(3u, CountingAllocator::live);
+    while (stack.size() > 4u) {
+        stack.pop();
+    }
+    ASSERT_EQ(2u, CountingAllocator::live);
+    stack.clear();
+    ASSERT_EQ(0u, CountingAllocator::live);
+}
+
+/**
+ * Os elementos nunca mudam de lugar: referencias continuam validas
+ * enquanto os elementos estao na pilha.
+ */
+TEST_F(SegmentedArrayStackTest, ReferenceStability) {
+    std::vector<int*> addresses;
+    for (auto i = 0; i < 20; ++i) {
+        stack.push(i);
+        addresses.push_back(&stack.top());
+    }
+    for (auto i = 0; i < 20; ++i) {
+        ASSERT_EQ(i, *addresses[i]);
+    }
+    auto& bottom = *addresses[0];
+    for (auto i = 0; i < 100; ++i) {
+        stack.push(i);
+    }
+    ASSERT_EQ(&bottom, &*stack.begin());
+    ASSERT_EQ(0, bottom);
+}
+
+TEST_F(SegmentedArrayStackTest, PushTopIntoNewBlock) {
+    structures::SegmentedArrayStack<std::string, CountingAllocator, 4u>
+        strings;
+    for (auto i = 0; i < 4; ++i) {
+        strings.push(std::string(40, static_cast<char>('a' + i)));
+    }
+    strings.push(strings.top());
+    ASSERT_EQ(std::string(40, 'd'), strings.pop());
+    ASSERT_EQ(std::string(40, 'd'), strings.top());
+
+    // Agora o bloco novo vem da reserva.
+    strings.emplace(std::move(strings.top()));
+    ASSERT_EQ(std::string(40, 'd'), strings.top());
+    ASSERT_EQ(5u, strings.size());
+}
+
+TEST_F(SegmentedArrayStackTest, CopyAndMove) {
+    structures::SegmentedArrayStack<std::string, CountingAllocator, 4u>
+        strings;
+    for (auto i = 0; i < 10; ++i) {
+        strings.push(std::string(40, static_cast<char>('a' + i)));
+    }
+    strings.pop();
+    auto expected = values(strings);
+
+    auto copy = strings;
+    ASSERT_EQ(expected, values(copy));
+    copy.pop();
+    ASSERT_EQ(expected, values(strings));
+
+    auto moved = std::move(copy);
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(8u, moved.size());
+    copy.push("again");
+    ASSERT_EQ("again", copy.top());
+
+    moved = strings;
+    ASSERT_EQ(expected, values(moved));
+    strings = std::move(moved);
+    ASSERT_EQ(expected, values(strings));
+
+    copy.swap(strings);
+    ASSERT_EQ(expected, values(copy));
+    ASSERT_EQ((std::vector<std::string>{"again"}), values(strings));
+}
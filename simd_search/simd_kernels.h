@@ -0,0 +1,53 @@
+// Copyright [2017] <Luiz Motta>
+
+// Sem include guard de proposito: simd_search.h inclui este arquivo uma
+// vez por extensao (avx2, sse42), dentro do namespace e do
+// "#pragma GCC target" correspondentes, onde Ops<T> ja esta definido.
+
+template<typename T>
+std::size_t find(const T* data, std::size_t size, const T& value) {
+    using O = Ops<T>;
+    auto needle = O::set1(value);
+    std::size_t i = 0;
+    for (; i + O::lanes <= size; i += O::lanes) {
+        auto mask = O::match(O::load(data + i), needle);
+        if (mask != 0u)
+            return i + static_cast<std::size_t>(__builtin_ctz(mask));
+    }
+    return i + scalar::find(data + i, size - i, value);
+}
+
+template<typename T>
+std::size_t count(const T* data, std::size_t size, const T& value) {
+    using O = Ops<T>;
+    auto needle = O::set1(value);
+    std::size_t total = 0;
+    std::size_t i = 0;
+    for (; i + O::lanes <= size; i += O::lanes) {
+        total += static_cast<std::size_t>(
+            __builtin_popcount(O::match(O::load(data + i), needle)));
+    }
+    return total + scalar::count(data + i, size - i, value);
+}
+
+template<typename T>
+std::size_t remove(T* data, std::size_t size, const T& value) {
+    using O = Ops<T>;
+    constexpr unsigned all = (1u << O::lanes) - 1u;
+    auto needle = O::set1(value);
+    std::size_t out = 0;
+    std::size_t i = 0;
+    for (; i + O::lanes <= size; i += O::lanes) {
+        // Grava o bloco inteiro em out <= i: so sobrescreve posicoes ja
+        // lidas, e o lixo depois das lanes mantidas eh sobrescrito depois.
+        auto block = O::load(data + i);
+        auto keep = ~O::match(block, needle) & all;
+        O::store(data + out, O::compact(block, keep));
+        out += static_cast<std::size_t>(__builtin_popcount(keep));
+    }
+    for (; i < size; ++i) {
+        if (!(data[i] == value))
+            data[out++] = data[i];
+    }
+    return out;
+}
@@ -0,0 +1,356 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_SIMD_SEARCH_H
+#define STRUCTURES_SIMD_SEARCH_H
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && \
+    !defined(__clang__)
+#define STRUCTURES_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace structures {
+/*!
+ *  \brief Buscas sobre vetores contiguos (find, count e remove).
+ *
+ *  Para tipos aritmeticos de 4 ou 8 bytes as buscas comparam um bloco
+ *  inteiro de elementos por instrucao (AVX2 ou SSE4.2, escolhido em tempo
+ *  de execucao); os demais tipos, e CPUs sem essas extensoes, usam o laco
+ *  escalar. Compara com ==, entao NaN nunca eh encontrado e 0.0 == -0.0,
+ *  igual ao laco escalar.
+ */
+namespace simd {
+
+/*!
+ *  \brief true se T tem versao vetorizada.
+ */
+template<typename T>
+struct is_vectorizable : std::integral_constant<bool,
+    std::is_arithmetic<T>::value && !std::is_same<T, bool>::value &&
+    (sizeof(T) == 4u || sizeof(T) == 8u)> {};
+
+namespace scalar {
+
+template<typename T>
+std::size_t find(const T* data, std::size_t size, const T& value) {
+    for (std::size_t i = 0; i < size; ++i) {
+        if (data[i] == value)
+            return i;
+    }
+    return size;
+}
+
+template<typename T>
+std::size_t count(const T* data, std::size_t size, const T& value) {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        if (data[i] == value)
+            ++total;
+    }
+    return total;
+}
+
+template<typename T>
+std::size_t remove(T* data, std::size_t size, const T& value) {
+    std::size_t out = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        if (!(data[i] == value)) {
+            if (out != i)
+                data[out] = std::move(data[i]);
+            ++out;
+        }
+    }
+    return out;
+}
+
+}  // namespace scalar
+
+#ifdef STRUCTURES_SIMD_X86
+
+/*!
+ *  \brief Tabela de compactacao: para cada mascara de lanes mantidas, os
+ *  indices (em unidades de Unit) que levam essas lanes para o inicio do
+ *  vetor, na ordem.
+ */
+template<typename Unit, std::size_t Lanes, std::size_t UnitsPerLane>
+struct CompactTable {
+    struct Entry {
+        Unit units[Lanes * UnitsPerLane];
+    };
+
+    static constexpr std::array<Entry, (1u << Lanes)> make() {
+        std::array<Entry, (1u << Lanes)> entries{};
+        for (std::size_t mask = 0; mask < entries.size(); ++mask) {
+            std::size_t out = 0;
+            for (std::size_t lane = 0; lane < Lanes; ++lane) {
+                if ((mask >> lane) & 1u) {
+                    for (std::size_t k = 0; k < UnitsPerLane; ++k) {
+                        entries[mask].units[out++] =
+                            static_cast<Unit>(lane * UnitsPerLane + k);
+                    }
+                }
+            }
+        }
+        return entries;
+    }
+
+    static constexpr std::array<Entry, (1u << Lanes)> entries = make();
+};
+
+template<typename T>
+std::uint32_t bits32(T value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+template<typename T>
+std::uint64_t bits64(T value) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+namespace avx2 {
+
+template<std::size_t Size>
+struct Vector {
+    using vector = __m256i;
+    static constexpr std::size_t lanes = 32u / Size;
+
+    static vector load(const void* data) {
+        return _mm256_loadu_si256(static_cast<const __m256i*>(data));
+    }
+
+    static void store(void* data, vector v) {
+        _mm256_storeu_si256(static_cast<__m256i*>(data), v);
+    }
+
+    template<typename T>
+    static vector set1(T value) {
+        if constexpr (Size == 4u)
+            return _mm256_set1_epi32(static_cast<int>(bits32(value)));
+        else
+            return _mm256_set1_epi64x(
+                static_cast<long long>(bits64(value)));
+    }
+
+    static vector compact(vector v, unsigned keep) {
+        using Table = CompactTable<std::int32_t, lanes, Size / 4u>;
+        return _mm256_permutevar8x32_epi32(
+            v, load(Table::entries[keep].units));
+    }
+};
+
+template<typename T, std::size_t Size = sizeof(T),
+         bool Float = std::is_floating_point<T>::value>
+struct Ops;
+
+template<typename T>
+struct Ops<T, 4u, false> : Vector<4u> {
+    static unsigned match(vector a, vector b) {
+        return _mm256_movemask_ps(_mm256_castsi256_ps(
+            _mm256_cmpeq_epi32(a, b)));
+    }
+};
+
+template<typename T>
+struct Ops<T, 8u, false> : Vector<8u> {
+    static unsigned match(vector a, vector b) {
+        return _mm256_movemask_pd(_mm256_castsi256_pd(
+            _mm256_cmpeq_epi64(a, b)));
+    }
+};
+
+template<typename T>
+struct Ops<T, 4u, true> : Vector<4u> {
+    static unsigned match(vector a, vector b) {
+        return _mm256_movemask_ps(_mm256_cmp_ps(
+            _mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+    }
+};
+
+template<typename T>
+struct Ops<T, 8u, true> : Vector<8u> {
+    static unsigned match(vector a, vector b) {
+        return _mm256_movemask_pd(_mm256_cmp_pd(
+            _mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+    }
+};
+
+#include "simd_kernels.h"
+
+}  // namespace avx2
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("sse4.2")
+namespace sse42 {
+
+template<std::size_t Size>
+struct Vector {
+    using vector = __m128i;
+    static constexpr std::size_t lanes = 16u / Size;
+
+    static vector load(const void* data) {
+        return _mm_loadu_si128(static_cast<const __m128i*>(data));
+    }
+
+    static void store(void* data, vector v) {
+        _mm_storeu_si128(static_cast<__m128i*>(data), v);
+    }
+
+    template<typename T>
+    static vector set1(T value) {
+        if constexpr (Size == 4u)
+            return _mm_set1_epi32(static_cast<int>(bits32(value)));
+        else
+            return _mm_set1_epi64x(static_cast<long long>(bits64(value)));
+    }
+
+    static vector compact(vector v, unsigned keep) {
+        using Table = CompactTable<std::int8_t, lanes, Size>;
+        return _mm_shuffle_epi8(v, load(Table::entries[keep].units));
+    }
+};
+
+template<typename T, std::size_t Size = sizeof(T),
+         bool Float = std::is_floating_point<T>::value>
+struct Ops;
+
+template<typename T>
+struct Ops<T, 4u, false> : Vector<4u> {
+    static unsigned match(vector a, vector b) {
+        return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)));
+    }
+};
+
+template<typename T>
+struct Ops<T, 8u, false> : Vector<8u> {
+    static unsigned match(vector a, vector b) {
+        return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(a, b)));
+    }
+};
+
+template<typename T>
+struct Ops<T, 4u, true> : Vector<4u> {
+    static unsigned match(vector a, vector b) {
+        return _mm_movemask_ps(_mm_cmpeq_ps(_mm_castsi128_ps(a),
+                                            _mm_castsi128_ps(b)));
+    }
+};
+
+template<typename T>
+struct Ops<T, 8u, true> : Vector<8u> {
+    static unsigned match(vector a, vector b) {
+        return _mm_movemask_pd(_mm_cmpeq_pd(_mm_castsi128_pd(a),
+                                            _mm_castsi128_pd(b)));
+    }
+};
+
+#include "simd_kernels.h"
+
+}  // namespace sse42
+#pragma GCC pop_options
+
+enum class Level { SCALAR, SSE42, AVX2 };
+
+/*!
+ *  \brief Extensao usada nesta CPU, detectada uma unica vez.
+ */
+inline Level level() {
+#ifdef __AVX2__
+    return Level::AVX2;
+#else
+    static const Level detected = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            return Level::AVX2;
+        if (__builtin_cpu_supports("sse4.2"))
+            return Level::SSE42;
+        return Level::SCALAR;
+    }();
+    return detected;
+#endif
+}
+
+#endif  // STRUCTURES_SIMD_X86
+
+/*!
+ *  \brief Posicao da primeira ocorrencia de value.
+ *
+ *  \return indice do elemento, ou size se nao houver.
+ */
+template<typename T>
+std::size_t find(const T* data, std::size_t size, const T& value) {
+#ifdef STRUCTURES_SIMD_X86
+    if constexpr (is_vectorizable<T>::value) {
+        switch (level()) {
+        case Level::AVX2:
+            return avx2::find(data, size, value);
+        case Level::SSE42:
+            return sse42::find(data, size, value);
+        case Level::SCALAR:
+            break;
+        }
+    }
+#endif
+    return scalar::find(data, size, value);
+}
+
+/*!
+ *  \brief Quantidade de elementos iguais a value.
+ */
+template<typename T>
+std::size_t count(const T* data, std::size_t size, const T& value) {
+#ifdef STRUCTURES_SIMD_X86
+    if constexpr (is_vectorizable<T>::value) {
+        switch (level()) {
+        case Level::AVX2:
+            return avx2::count(data, size, value);
+        case Level::SSE42:
+            return sse42::count(data, size, value);
+        case Level::SCALAR:
+            break;
+        }
+    }
+#endif
+    return scalar::count(data, size, value);
+}
+
+/*!
+ *  \brief Compacta o vetor retirando os elementos iguais a value, mantendo
+ *  a ordem dos demais (como std::remove).
+ *
+ *  \return novo tamanho; as posicoes a partir dele ficam com valores
+ *  validos mas nao especificados.
+ */
+template<typename T>
+std::size_t remove(T* data, std::size_t size, const T& value) {
+#ifdef STRUCTURES_SIMD_X86
+    if constexpr (is_vectorizable<T>::value) {
+        switch (level()) {
+        case Level::AVX2:
+            return avx2::remove(data, size, value);
+        case Level::SSE42:
+            return sse42::remove(data, size, value);
+        case Level::SCALAR:
+            break;
+        }
+    }
+#endif
+    return scalar::remove(data, size, value);
+}
+
+}  // namespace simd
+}  // namespace structures
+
+#endif
@@ -0,0 +1,135 @@
+/* Copyright [2017] <Luiz Motta> */
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "simd_search.h"
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+/**
+ * Teste diferencial das buscas vetorizadas contra o laco escalar
+ */
+
+namespace simd = structures::simd;
+
+template<typename T>
+class SimdSearchTest: public ::testing::Test {
+protected:
+    /**
+     * Valores usados para preencher os vetores; poucos valores diferentes
+     * para que haja muitas ocorrencias, com NaN e -0.0 nos de ponto
+     * flutuante.
+     */
+    static std::vector<T> alphabet() {
+        std::vector<T> values{T(0), T(1), T(2), T(7),
+                              std::numeric_limits<T>::max()};
+        if constexpr (std::is_floating_point<T>::value) {
+            values.push_back(-T(0));
+            values.push_back(std::numeric_limits<T>::quiet_NaN());
+        } else if constexpr (std::is_signed<T>::value) {
+            values.push_back(T(-1));
+            values.push_back(std::numeric_limits<T>::min());
+        }
+        return values;
+    }
+
+    /**
+     * Compara find, count e remove de uma implementacao com os do laco
+     * escalar para todos os tamanhos de 0 a 299 e todos os valores.
+     */
+    template<typename Find, typename Count, typename Remove>
+    static void check(Find find, Count count, Remove remove) {
+        auto values = alphabet();
+        std::mt19937 random{42u};
+        std::uniform_int_distribution<std::size_t> pick{0u,
+                                                        values.size() - 1};
+        for (std::size_t size = 0; size < 300u; ++size) {
+            std::vector<T> data(size);
+            for (auto& element : data) {
+                element = values[pick(random)];
+            }
+            for (const auto& value : values) {
+                ASSERT_EQ(simd::scalar::find(data.data(), size, value),
+                          find(data.data(), size, value))
+                    << "find, size " << size;
+                ASSERT_EQ(simd::scalar::count(data.data(), size, value),
+                          count(data.data(), size, value))
+                    << "count, size " << size;
+
+                auto expected = data;
+                auto actual = data;
+                auto expected_size = simd::scalar::remove(
+                    expected.data(), size, value);
+                auto actual_size = remove(actual.data(), size, value);
+                ASSERT_EQ(expected_size, actual_size)
+                    << "remove, size " << size;
+                // Bit a bit, para comparar NaN e -0.0.
+                ASSERT_EQ(0, std::memcmp(expected.data(), actual.data(),
+                                         expected_size * sizeof(T)))
+                    << "remove, size " << size;
+            }
+        }
+    }
+};
+
+using SimdTypes = ::testing::Types<std::int32_t, std::uint32_t,
+                                   std::int64_t, std::uint64_t,
+                                   float, double>;
+TYPED_TEST_SUITE(SimdSearchTest, SimdTypes);
+
+TYPED_TEST(SimdSearchTest, Dispatch) {
+    using T = TypeParam;
+    this->check(
+        [](const T* data, std::size_t size, const T& value) {
+            return simd::find(data, size, value);
+        },
+        [](const T* data, std::size_t size, const T& value) {
+            return simd::count(data, size, value);
+        },
+        [](T* data, std::size_t size, const T& value) {
+            return simd::remove(data, size, value);
+        });
+}
+
+#ifdef STRUCTURES_SIMD_X86
+
+TYPED_TEST(SimdSearchTest, Avx2) {
+    using T = TypeParam;
+    if (!__builtin_cpu_supports("avx2"))
+        GTEST_SKIP() << "CPU sem AVX2";
+    this->check(
+        [](const T* data, std::size_t size, const T& value) {
+            return simd::avx2::find(data, size, value);
+        },
+        [](const T* data, std::size_t size, const T& value) {
+            return simd::avx2::count(data, size, value);
+        },
+        [](T* data, std::size_t size, const T& value) {
+            return simd::avx2::remove(data, size, value);
+        });
+}
+
+TYPED_TEST(SimdSearchTest, Sse42) {
+    using T = TypeParam;
+    if (!__builtin_cpu_supports("sse4.2"))
+        GTEST_SKIP() << "CPU sem SSE4.2";
+    this->check(
+        [](const T* data, std::size_t size, const T& value) {
+            return simd::sse42::find(data, size, value);
+        },
+        [](const T* data, std::size_t size, const T& value) {
+            return simd::sse42::count(data, size, value);
+        },
+        [](T* data, std::size_t size, const T& value) {
+            return simd::sse42::remove(data, size, value);
+        });
+}
+
+#endif
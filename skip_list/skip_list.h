@@ -0,0 +1,636 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_SKIP_LIST_H
+#define STRUCTURES_SKIP_LIST_H
+
+#include <array>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "../node_iterator/node_iterator.h"
+#include "../node_pool/node_pool.h"
+
+namespace structures {
+
+/*!
+ * \brief Um NodePool por altura de torre: a torre de altura h ocupa
+ * Offset + h * Step bytes.
+ */
+template<std::size_t Offset, std::size_t Step, std::size_t Align,
+         typename Heights>
+class TowerPool;
+
+template<std::size_t Offset, std::size_t Step, std::size_t Align,
+         std::size_t... H>
+class TowerPool<Offset, Step, Align, std::index_sequence<H...>> {
+ public:
+    void* allocate(std::size_t height) {
+        void* block = nullptr;
+        static_cast<void>(((height == H + 1u ?
+            (block = std::get<H>(pools_).allocate(), true) : false) || ...));
+        return block;
+    }
+
+    void deallocate(void* block, std::size_t height) {
+        static_cast<void>(((height == H + 1u ?
+            (std::get<H>(pools_).deallocate(block), true) : false) || ...));
+    }
+
+ private:
+    std::tuple<NodePool<Offset + (H + 1u) * Step, Align>...> pools_;
+};
+
+/*!
+ * \brief SkipList eh uma lista encadeada ordenada com atalhos.
+ *
+ * Cada Node tem uma torre de altura aleatoria (P(h) = 4^-h) com um
+ * ponteiro por nivel; as buscas descem pelos niveis e custam O(log n)
+ * esperado. Cada ligacao guarda tambem quantos elementos ela pula, entao
+ * find devolve a posicao e at/pop por indice tambem sao O(log n).
+ *
+ * O Node e sua torre ficam num unico bloco, vindo de um NodePool proprio
+ * para cada altura. A iteracao percorre o nivel 0 em ordem; os elementos
+ * so podem ser lidos, ja que altera-los quebraria a ordem.
+ */
+template<typename T>
+class SkipList {
+    class Node;
+
+ public:
+    using value_type = T;
+    using iterator = ForwardNodeIterator<const T, const Node>;
+    using const_iterator = ForwardNodeIterator<const T, const Node>;
+
+    /*!
+     * \brief Construtor da lista vazia
+     */
+    SkipList();
+
+    /*!
+     * \brief Construtor de copia, copia todos os elementos de other em O(n)
+     */
+    SkipList(const SkipList& other);
+
+    /*!
+     * \brief Construtor de movimento, assume os Nodes de other sem alocar
+     */
+    SkipList(SkipList&& other) noexcept;
+
+    /*!
+     * \brief Atribuicao por copia
+     */
+    SkipList& operator=(const SkipList& other);
+
+    /*!
+     * \brief Atribuicao por movimento
+     */
+    SkipList& operator=(SkipList&& other) noexcept;
+
+    /*!
+     * \brief Destrutor, libera todos os Nodes
+     */
+    ~SkipList();
+
+    /*!
+     * \brief Troca o conteudo com outra lista em O(1)
+     */
+    void swap(SkipList& other) noexcept;
+
+    /*!
+     * \brief Remove todos os elementos
+     */
+    void clear();
+
+    /*!
+     * \brief Coloca um elemento antes do primeiro elemento nao menor que
+     * ele
+     *
+     * \param data, dado a ser armazenado
+     */
+    void insert_sorted(const T& data);
+
+    /*!
+     * \brief Coloca um elemento na ordem, movendo o dado
+     *
+     * \param data, dado a ser armazenado
+     */
+    void insert_sorted(T&& data);
+
+    /*!
+     * \brief Constroi um elemento e o coloca na ordem
+     *
+     * \param args, argumentos repassados ao construtor de T
+     *
+     * \return referencia do elemento construido
+     */
+    template<typename... Args>
+    const T& emplace(Args&&... args);
+
+    /*!
+     * \brief Acessa o elemento na posicao index
+     *
+     * \return referencia do elemento
+     */
+    const T& at(std::size_t index) const;
+
+    /*!
+     * \brief Acessa o elemento na posicao index
+     *
+     * \return referencia do elemento
+     */
+    const T& operator[](std::size_t index) const;
+
+    /*!
+     * \brief Acessa o menor elemento
+     *
+     * \return referencia do primeiro elemento
+     */
+    const T& front() const;
+
+    /*!
+     * \brief Retira o elemento na posicao index
+     *
+     * \return o dado retirado
+     */
+    T pop(std::size_t index);
+
+    /*!
+     * \brief Retira o menor elemento
+     *
+     * \return o dado retirado
+     */
+    T pop_front();
+
+    /*!
+     * \brief Retira a primeira ocorrencia de data
+     *
+     * \param data, dado a ser retirado
+     */
+    void remove(const T& data);
+
+    /*!
+     * \brief Verifica se a lista esta vazia
+     *
+     * \return true caso a lista esteja vazia
+     */
+    bool empty() const;
+
+    /*!
+     * \brief Verifica se a lista contem data
+     *
+     * \return true caso data esteja na lista
+     */
+    bool contains(const T& data) const;
+
+    /*!
+     * \brief Procura a primeira ocorrencia de data
+     *
+     * \return posicao do dado, ou size() se nao houver
+     */
+    std::size_t find(const T& data) const;
+
+    /*!
+     * \brief Passa o tamanho da lista
+     *
+     * \return tamanho da lista
+     */
+    std::size_t size() const;
+
+    /*!
+     * \brief Iterador constante para o menor elemento
+     *
+     * \return iterador constante para o primeiro elemento
+     */
+    const_iterator begin() const;
+
+    /*!
+     * \brief Iterador constante para o menor elemento
+     *
+     * \return iterador constante para o primeiro elemento
+     */
+    const_iterator cbegin() const;
+
+    /*!
+     * \brief Iterador constante para depois do maior elemento
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator end() const;
+
+    /*!
+     * \brief Iterador constante para depois do maior elemento
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator cend() const;
+
+ private:
+    static constexpr std::size_t MAX_LEVEL = 16u;
+
+    /*!
+     * \brief Ligacao de um nivel: proximo Node e quantos elementos ela
+     * avanca (so vale quando next nao eh nullptr).
+     */
+    struct Link {
+        Node* next{nullptr};
+        std::size_t width{0u};
+    };
+
+    class Node {
+     public:
+        template<typename... Args>
+        Node(std::in_place_t, std::size_t height, Args&&... args):
+            data_(std::forward<Args>(args)...), height_{height} {
+            for (auto i = 0u; i < height; ++i) {
+                new (links() + i) Link();
+            }
+        }
+
+        const T& data() const { return data_; }
+
+        T& data() { return data_; }
+
+        std::size_t height() const { return height_; }
+
+        const Node* next() const { return links()[0].next; }
+
+        Link* links() {
+            return std::launder(reinterpret_cast<Link*>(
+                reinterpret_cast<unsigned char*>(this) + LINKS_OFFSET));
+        }
+
+        const Link* links() const {
+            return std::launder(reinterpret_cast<const Link*>(
+                reinterpret_cast<const unsigned char*>(this) + LINKS_OFFSET));
+        }
+
+     private:
+        T data_;
+        std::size_t height_;
+    };
+
+    static constexpr std::size_t LINKS_OFFSET =
+        (sizeof(Node) + alignof(Link) - 1u) / alignof(Link) * alignof(Link);
+    static constexpr std::size_t NODE_ALIGN =
+        alignof(Node) > alignof(Link) ? alignof(Node) : alignof(Link);
+
+    /*!
+     * \brief Ligacoes que precedem uma posicao em cada nivel, e a posicao
+     * (1 para o primeiro elemento, 0 para o inicio) de onde cada uma sai.
+     */
+    struct Path {
+        std::array<Link*, MAX_LEVEL> links;
+        std::array<std::size_t, MAX_LEVEL> rank;
+    };
+
+    Path lower_bound(const T& data);
+
+    Path position(std::size_t index);
+
+    void link(Node* node, Path path);
+
+    T unlink(const Path& path);
+
+    std::size_t random_height();
+
+    template<typename... Args>
+    Node* create(std::size_t height, Args&&... args);
+
+    void destroy(Node* node);
+
+    TowerPool<LINKS_OFFSET, sizeof(Link), NODE_ALIGN,
+              std::make_index_sequence<MAX_LEVEL>> pool_;
+    std::array<Link, MAX_LEVEL> head;
+    std::size_t level_{1u};
+    std::size_t size_{0u};
+    std::uint64_t random_{0x9E3779B97F4A7C15u};
+};
+
+    template<typename T>
+    SkipList<T>::SkipList() = default;
+
+    template<typename T>
+    SkipList<T>::SkipList(const SkipList& other) {
+        // Os elementos de other ja estao em ordem: cada um eh ligado depois
+        // do ultimo Node de cada nivel, sem busca.
+        std::array<Link*, MAX_LEVEL> last;
+        std::array<std::size_t, MAX_LEVEL> rank{};
+        for (auto level = 0u; level < MAX_LEVEL; ++level) {
+            last[level] = &head[level];
+        }
+        try {
+            for (auto& data : other) {
+                auto height = random_height();
+                auto node = create(height, data);
+                ++size_;
+                for (auto level = 0u; level < height; ++level) {
+                    last[level]->next = node;
+                    last[level]->width = size_ - rank[level];
+                    last[level] = &node->links()[level];
+                    rank[level] = size_;
+                }
+                if (height > level_)
+                    level_ = height;
+            }
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    template<typename T>
+    SkipList<T>::SkipList(SkipList&& other) noexcept :
+        pool_{std::move(other.pool_)},
+        head{other.head},
+        level_{std::exchange(other.level_, 1u)},
+        size_{std::exchange(other.size_, 0u)},
+        random_{other.random_}
+    {
+        other.head.fill(Link());
+    }
+
+    template<typename T>
+    SkipList<T>& SkipList<T>::operator=(const SkipList& other) {
+        if (this != &other) {
+            SkipList copy{other};
+            swap(copy);
+        }
+        return *this;
+    }
+
+    template<typename T>
+    SkipList<T>& SkipList<T>::operator=(SkipList&& other) noexcept {
+        if (this != &other) {
+            SkipList moved{std::move(other)};
+            swap(moved);
+        }
+        return *this;
+    }
+
+    template<typename T>
+    SkipList<T>::~SkipList() { clear(); }
+
+    template<typename T>
+    void SkipList<T>::swap(SkipList& other) noexcept {
+        std::swap(pool_, other.pool_);
+        std::swap(head, other.head);
+        std::swap(level_, other.level_);
+        std::swap(size_, other.size_);
+        std::swap(random_, other.random_);
+    }
+
+    template<typename T>
+    void SkipList<T>::clear() {
+        auto it = head[0].next;
+        while (it != nullptr) {
+            auto next = it->links()[0].next;
+            destroy(it);
+            it = next;
+        }
+        head.fill(Link());
+        level_ = 1u;
+        size_ = 0u;
+    }
+
+    template<typename T>
+    void SkipList<T>::insert_sorted(const T& data) {
+        emplace(data);
+    }
+
+    template<typename T>
+    void SkipList<T>::insert_sorted(T&& data) {
+        emplace(std::move(data));
+    }
+
+    template<typename T>
+    template<typename... Args>
+    const T& SkipList<T>::emplace(Args&&... args) {
+        auto node = create(random_height(), std::forward<Args>(args)...);
+        link(node, lower_bound(node->data()));
+        return node->data();
+    }
+
+    template<typename T>
+    const T& SkipList<T>::at(std::size_t index) const {
+        if (index >= size_)
+            throw std::out_of_range("INDEX OUT OF BOUNDS AT");
+        std::size_t rank = 0u;
+        auto links = head.data();
+        const Node* node = nullptr;
+        for (auto level = level_; level-- > 0u;) {
+            while (links[level].next != nullptr &&
+                   rank + links[level].width <= index + 1u) {
+                rank += links[level].width;
+                node = links[level].next;
+                links = node->links();
+            }
+        }
+        return node->data();
+    }
+
+    template<typename T>
+    const T& SkipList<T>::operator[](std::size_t index) const {
+        return at(index);
+    }
+
+    template<typename T>
+    const T& SkipList<T>::front() const {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        return head[0].next->data();
+    }
+
+    template<typename T>
+    T SkipList<T>::pop(std::size_t index) {
+        if (index >= size_)
+            throw std::out_of_range("INDEX OUT OF BOUNDS POP");
+        return unlink(position(index));
+    }
+
+    template<typename T>
+    T SkipList<T>::pop_front() {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        return unlink(position(0u));
+    }
+
+    template<typename T>
+    void SkipList<T>::remove(const T& data) {
+        auto path = lower_bound(data);
+        auto node = path.links[0]->next;
+        if (node == nullptr || !(node->data() == data))
+            throw std::out_of_range("NOT FOUND");
+        unlink(path);
+    }
+
+    template<typename T>
+    bool SkipList<T>::empty() const { return size() == 0u; }
+
+    template<typename T>
+    bool SkipList<T>::contains(const T& data) const {
+        return find(data) != size_;
+    }
+
+    template<typename T>
+    std::size_t SkipList<T>::find(const T& data) const {
+        std::size_t rank = 0u;
+        auto links = head.data();
+        for (auto level = level_; level-- > 0u;) {
+            while (links[level].next != nullptr &&
+                   links[level].next->data() < data) {
+                rank += links[level].width;
+                links = links[level].next->links();
+            }
+        }
+        auto node = links[0].next;
+        if (node == nullptr || !(node->data() == data))
+            return size_;
+        return rank;
+    }
+
+    template<typename T>
+    std::size_t SkipList<T>::size() const { return size_; }
+
+    template<typename T>
+    typename SkipList<T>::const_iterator SkipList<T>::begin() const {
+        return const_iterator{head[0].next, 0u};
+    }
+
+    template<typename T>
+    typename SkipList<T>::const_iterator SkipList<T>::cbegin() const {
+        return begin();
+    }
+
+    template<typename T>
+    typename SkipList<T>::const_iterator SkipList<T>::end() const {
+        return const_iterator{nullptr, size_};
+    }
+
+    template<typename T>
+    typename SkipList<T>::const_iterator SkipList<T>::cend() const {
+        return end();
+    }
+
+    template<typename T>
+    typename SkipList<T>::Path SkipList<T>::lower_bound(const T& data) {
+        Path path;
+        std::size_t rank = 0u;
+        auto links = head.data();
+        for (auto level = level_; level-- > 0u;) {
+            while (links[level].next != nullptr &&
+                   links[level].next->data() < data) {
+                rank += links[level].width;
+                links = links[level].next->links();
+            }
+            path.links[level] = &links[level];
+            path.rank[level] = rank;
+        }
+        return path;
+    }
+
+    template<typename T>
+    typename SkipList<T>::Path SkipList<T>::position(std::size_t index) {
+        Path path;
+        std::size_t rank = 0u;
+        auto links = head.data();
+        for (auto level = level_; level-- > 0u;) {
+            while (links[level].next != nullptr &&
+                   rank + links[level].width <= index) {
+                rank += links[level].width;
+                links = links[level].next->links();
+            }
+            path.links[level] = &links[level];
+            path.rank[level] = rank;
+        }
+        return path;
+    }
+
+    template<typename T>
+    void SkipList<T>::link(Node* node, Path path) {
+        auto height = node->height();
+        for (auto level = level_; level < height; ++level) {
+            path.links[level] = &head[level];
+            path.rank[level] = 0u;
+        }
+        if (height > level_)
+            level_ = height;
+
+        auto links = node->links();
+        auto rank = path.rank[0] + 1u;
+        for (auto level = 0u; level < height; ++level) {
+            auto prev = path.links[level];
+            links[level].next = prev->next;
+            links[level].width = prev->width - (rank - 1u - path.rank[level]);
+            prev->next = node;
+            prev->width = rank - path.rank[level];
+        }
+        for (auto level = height; level < level_; ++level) {
+            ++path.links[level]->width;
+        }
+        ++size_;
+    }
+
+    template<typename T>
+    T SkipList<T>::unlink(const Path& path) {
+        auto node = path.links[0]->next;
+        auto links = node->links();
+        for (auto level = 0u; level < level_; ++level) {
+            auto prev = path.links[level];
+            if (prev->next == node) {
+                prev->next = links[level].next;
+                prev->width += links[level].width - 1u;
+            } else {
+                --prev->width;
+            }
+        }
+        while (level_ > 1u && head[level_ - 1u].next == nullptr) {
+            --level_;
+        }
+        --size_;
+        auto data = std::move(node->data());
+        destroy(node);
+        return data;
+    }
+
+    template<typename T>
+    std::size_t SkipList<T>::random_height() {
+        // xorshift64; cada par de bits zero sobe um nivel (P = 1/4).
+        random_ ^= random_ << 13;
+        random_ ^= random_ >> 7;
+        random_ ^= random_ << 17;
+        auto bits = random_;
+        std::size_t height = 1u;
+        while (height < MAX_LEVEL && (bits & 3u) == 0u) {
+            ++height;
+            bits >>= 2;
+        }
+        return height;
+    }
+
+    template<typename T>
+    template<typename... Args>
+    typename SkipList<T>::Node* SkipList<T>::create(std::size_t height,
+                                                    Args&&... args) {
+        auto block = pool_.allocate(height);
+        try {
+            return new (block) Node(std::in_place, height,
+                                    std::forward<Args>(args)...);
+        } catch (...) {
+            pool_.deallocate(block, height);
+            throw;
+        }
+    }
+
+    template<typename T>
+    void SkipList<T>::destroy(Node* node) {
+        auto height = node->height();
+        node->~Node();
+        pool_.deallocate(node, height);
+    }
+
+}  // namespace structures
+
+#endif
@@ -0,0 +1,226 @@
+/* Copyright [2017] <Luiz Motta> */
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "skip_list.h"
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+/**
+ * Teste unitario para lista com atalhos, conferida contra um std::multiset
+ */
+
+class SkipListTest: public ::testing::Test {
+protected:
+    /**
+     * Confere a lista contra o multiset de referencia: iteracao, at() e
+     * operator[] em todas as posicoes.
+     */
+    template<typename U>
+    static void expect_equal(const std::multiset<U>& expected,
+                             const structures::SkipList<U>& actual) {
+        ASSERT_EQ(expected.size(), actual.size());
+        ASSERT_EQ(expected.empty(), actual.empty());
+        ASSERT_TRUE(std::equal(expected.begin(), expected.end(),
+                               actual.begin(), actual.end()));
+        auto index = 0u;
+        for (const auto& data : expected) {
+            ASSERT_EQ(data, actual.at(index)) << "index " << index;
+            ASSERT_EQ(data, actual[index]) << "index " << index;
+            ++index;
+        }
+    }
+
+    /**
+     * Posicao da primeira ocorrencia de data no multiset, ou size() se
+     * nao houver
+     */
+    template<typename U>
+    static std::size_t position(const std::multiset<U>& expected,
+                                const U& data) {
+        auto it = expected.lower_bound(data);
+        if (it == expected.end() || !(*it == data))
+            return expected.size();
+        return static_cast<std::size_t>(std::distance(expected.begin(), it));
+    }
+
+    /**
+     * Lista na qual serao efetuadas as operações
+     */
+    structures::SkipList<int> list;
+};
+
+TEST_F(SkipListTest, Errors) {
+    ASSERT_TRUE(list.empty());
+    ASSERT_THROW(list.at(0u), std::out_of_range);
+    ASSERT_THROW(list.pop(0u), std::out_of_range);
+    ASSERT_THROW(list.front(), std::out_of_range);
+    ASSERT_THROW(list.pop_front(), std::out_of_range);
+    ASSERT_THROW(list.remove(1), std::out_of_range);
+    list.insert_sorted(1);
+    ASSERT_THROW(list.at(1u), std::out_of_range);
+    ASSERT_THROW(list.pop(1u), std::out_of_range);
+    ASSERT_THROW(list.remove(2), std::out_of_range);
+    ASSERT_EQ(1u, list.find(2));
+}
+
+TEST_F(SkipListTest, Duplicates) {
+    std::multiset<int> expected;
+    for (auto i = 0; i < 5; ++i) {
+        for (auto value : {3, 1, 2}) {
+            list.insert_sorted(value);
+            expected.insert(value);
+        }
+    }
+    expect_equal(expected, list);
+    ASSERT_EQ(0u, list.find(1));
+    ASSERT_EQ(5u, list.find(2));
+    ASSERT_EQ(10u, list.find(3));
+
+    // remove tira uma ocorrencia por vez.
+    for (auto i = 0; i < 5; ++i) {
+        ASSERT_TRUE(list.contains(2));
+        list.remove(2);
+        expected.erase(expected.find(2));
+        expect_equal(expected, list);
+        ASSERT_EQ(9u - i, list.find(3));
+    }
+    ASSERT_FALSE(list.contains(2));
+    ASSERT_EQ(list.size(), list.find(2));
+    ASSERT_EQ(5u, list.find(3));
+}
+
+/**
+ * Insercoes, retiradas por indice e remove aleatorios; depois de cada
+ * operacao, confere a ordem, o acesso por indice e find.
+ */
+TEST_F(SkipListTest, RandomOperations) {
+    std::mt19937 random{11u};
+    std::multiset<int> expected;
+    for (auto step = 0; step < 4000; ++step) {
+        auto op = random() % 5u;
+        if (op < 3u || expected.empty()) {
+            auto value = static_cast<int>(random() % 200u);
+            if (op == 0u)
+                list.emplace(value);
+            else
+                list.insert_sorted(value);
+            expected.insert(value);
+        } else if (op == 3u) {
+            auto index = random() % expected.size();
+            auto it = std::next(expected.begin(), index);
+            ASSERT_EQ(*it, list.pop(index));
+            expected.erase(it);
+        } else {
+            auto value = static_cast<int>(random() % 200u);
+            if (expected.count(value) == 0u) {
+                ASSERT_THROW(list.remove(value), std::out_of_range);
+            } else {
+                list.remove(value);
+                expected.erase(expected.find(value));
+            }
+        }
+        if (step % 50 == 0)
+            expect_equal(expected, list);
+        auto value = static_cast<int>(random() % 200u);
+        ASSERT_EQ(position(expected, value), list.find(value));
+        ASSERT_EQ(expected.count(value) != 0u, list.contains(value));
+    }
+    expect_equal(expected, list);
+    while (!expected.empty()) {
+        ASSERT_EQ(*expected.begin(), list.front());
+        ASSERT_EQ(*expected.begin(), list.pop_front());
+        expected.erase(expected.begin());
+    }
+    ASSERT_TRUE(list.empty());
+}
+
+/**
+ * Cada altura de torre tem seu NodePool: um bloco devolvido volta na
+ * proxima alocacao da mesma altura, e nao na de outra.
+ */
+TEST_F(SkipListTest, TowerPoolReuse) {
+    structures::TowerPool<16u, 16u, 16u, std::make_index_sequence<4u>> pool;
+    std::vector<void*> blocks;
+    for (auto height = 1u; height <= 4u; ++height) {
+        blocks.push_back(pool.allocate(height));
+        ASSERT_NE(nullptr, blocks.back());
+    }
+    pool.deallocate(blocks[1], 2u);
+    pool.deallocate(blocks[3], 4u);
+    auto other = pool.allocate(3u);
+    ASSERT_NE(blocks[1], other);
+    ASSERT_NE(blocks[3], other);
+    ASSERT_EQ(blocks[3], pool.allocate(4u));
+    ASSERT_EQ(blocks[1], pool.allocate(2u));
+    pool.deallocate(other, 3u);
+    for (auto height = 1u; height <= 4u; ++height) {
+        pool.deallocate(blocks[height - 1u], height);
+    }
+}
+
+/**
+ * Enche e esvazia a lista varias vezes: as torres liberadas sao
+ * reaproveitadas pelas proximas insercoes.
+ */
+TEST_F(SkipListTest, RefillAfterDrain) {
+    structures::SkipList<std::string> strings;
+    std::multiset<std::string> expected;
+    std::mt19937 random{5u};
+    for (auto round = 0; round < 4; ++round) {
+        for (auto i = 0; i < 500; ++i) {
+            auto letter = static_cast<char>('a' + random() % 26u);
+            auto data = std::string(32, letter);
+            strings.insert_sorted(data);
+            expected.insert(data);
+        }
+        expect_equal(expected, strings);
+        while (strings.size() > 20u) {
+            auto index = random() % strings.size();
+            auto it = std::next(expected.begin(), index);
+            ASSERT_EQ(*it, strings.pop(index));
+            expected.erase(it);
+        }
+        expect_equal(expected, strings);
+    }
+    strings.clear();
+    ASSERT_TRUE(strings.empty());
+    strings.insert_sorted("x");
+    ASSERT_EQ("x", strings.front());
+}
+
+TEST_F(SkipListTest, CopyAndMove) {
+    std::multiset<int> expected;
+    for (auto i = 0; i < 300; ++i) {
+        list.insert_sorted(i % 37);
+        expected.insert(i % 37);
+    }
+
+    auto copy = list;
+    expect_equal(expected, copy);
+    copy.pop(0u);
+    expect_equal(expected, list);
+
+    auto moved = std::move(copy);
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(299u, moved.size());
+    copy.insert_sorted(1);
+    ASSERT_EQ(1, copy.front());
+
+    moved = list;
+    expect_equal(expected, moved);
+    list = std::move(moved);
+    expect_equal(expected, list);
+
+    copy.swap(list);
+    expect_equal(expected, copy);
+    ASSERT_EQ(1u, list.size());
+}
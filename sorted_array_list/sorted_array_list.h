@@ -0,0 +1,429 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_SORTED_ARRAY_LIST_H
+#define STRUCTURES_SORTED_ARRAY_LIST_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "../array_list/array_list.h"
+
+namespace structures {
+/*!
+* \brief Lista feita com vetor mantida sempre em ordem.
+*
+* Guarda os elementos num ArrayList que cresce automaticamente. A posicao
+* de insercao e as buscas usam busca binaria (O(log n)); inserir e
+* remover deslocam a cauda uma unica vez. Os elementos so podem ser lidos,
+* ja que altera-los quebraria a ordem.
+*/
+template<typename T, typename Compare = std::less<T>>
+class SortedArrayList {
+ public:
+    using value_type = T;
+    using iterator = const T*;
+    using const_iterator = const T*;
+
+    /*!
+    * \brief Construtor do SortedArrayList
+    */
+    SortedArrayList();
+
+    /*!
+    * \brief Contrutor do SortedArrayList com capacidade inicial
+    *
+    * \param max_size capacidade inicial
+    * \param compare criterio de ordenacao
+    */
+    explicit SortedArrayList(std::size_t max_size,
+                             const Compare& compare = Compare());
+
+    /*!
+    * \brief Constroi a lista a partir de um intervalo ja ordenado, em O(n).
+    *
+    * \param first, last intervalo de iteradores de avanco, ordenado
+    * segundo compare
+    * \param compare criterio de ordenacao
+    *
+    * \return lista com os elementos do intervalo
+    */
+    template<typename ForwardIt>
+    static SortedArrayList from_sorted_range(ForwardIt first, ForwardIt last,
+                                             const Compare& compare =
+                                                 Compare());
+
+    /*!
+    * \brief Limpa o SortedArrayList.
+    */
+    void clear();
+
+    /*!
+    * \brief Adiciona elemento na ordem, depois dos iguais a ele.
+    *
+    * \param data
+    *
+    * \return index do elemento inserido
+    */
+    std::size_t insert_sorted(const T& data);
+
+    /*!
+    * \brief Adiciona elemento na ordem, movendo o dado.
+    *
+    * \param data
+    *
+    * \return index do elemento inserido
+    */
+    std::size_t insert_sorted(T&& data);
+
+    /*!
+    * \brief Adiciona todos os elementos de [first, last) na ordem.
+    *
+    * Os elementos sao colocados no final, ordenados e intercalados com os
+    * existentes: O(n + K log K) em vez de K insercoes de O(n).
+    *
+    * \param first, last intervalo de iteradores de avanco
+    */
+    template<typename ForwardIt>
+    void insert_sorted_range(ForwardIt first, ForwardIt last);
+
+    /*!
+    * \brief Remove um elemento na posicao.
+    *
+    * \param index
+    *
+    * \return elemento do index.
+    */
+    T pop(std::size_t index);
+
+    /*!
+    * \brief Remove o maior elemento.
+    *
+    * \return ultimo elemento.
+    */
+    T pop_back();
+
+    /*!
+    * \brief Remove o menor elemento.
+    *
+    * \return primeiro elemento.
+    */
+    T pop_front();
+
+    /*!
+    * \brief Remove um elemento especifico.
+    *
+    * \param data
+    */
+    void remove(const T& data);
+
+    /*!
+    * \brief Remove os elementos das posicoes [first, last).
+    *
+    * \param first, last
+    */
+    void erase_range(std::size_t first, std::size_t last);
+
+    /*!
+    * \brief Remove todos os elementos para os quais pred eh verdadeiro.
+    *
+    * \param pred
+    *
+    * \return quantidade de elementos removidos
+    */
+    template<typename Predicate>
+    std::size_t erase_if(Predicate pred);
+
+    /*!
+    * \brief Testa se o SortedArrayList esta vazio.
+    *
+    * \return true se estiver vazio, false se tiver elemento
+    */
+    bool empty() const;
+
+    /*!
+    * \brief Testa se o SortedArrayList contem um dado especifico.
+    *
+    * \param data
+    *
+    * \return true se possui o elemento data
+    */
+    bool contains(const T& data) const;
+
+    /*!
+    * \brief Retorna o index da primeira ocorrencia de um dado.
+    *
+    * \param data
+    *
+    * \return index do elemento data, ou size() se nao houver
+    */
+    std::size_t find(const T& data) const;
+
+    /*!
+    * \brief Retorna o index do primeiro elemento que nao eh menor que data.
+    *
+    * \param data
+    *
+    * \return index, ou size() se todos forem menores
+    */
+    std::size_t lower_bound(const T& data) const;
+
+    /*!
+    * \brief Retorna o index do primeiro elemento maior que data.
+    *
+    * \param data
+    *
+    * \return index, ou size() se nenhum for maior
+    */
+    std::size_t upper_bound(const T& data) const;
+
+    /*!
+    * \brief Retorna o tamanho do SortedArrayList.
+    *
+    * \return tamanho do SortedArrayList
+    */
+    std::size_t size() const;
+
+    /*!
+    * \brief Retorna a capacidade atual do SortedArrayList.
+    *
+    * \return capacidade do SortedArrayList
+    */
+    std::size_t max_size() const;
+
+    /*!
+    * \brief Garante capacidade para pelo menos new_cap elementos.
+    *
+    * \param new_cap
+    */
+    void reserve(std::size_t new_cap);
+
+    /*!
+    * \brief Iterador para o menor elemento.
+    *
+    * \return iterador para o primeiro elemento.
+    */
+    const_iterator begin() const;
+
+    /*!
+    * \brief Iterador para depois do maior elemento.
+    *
+    * \return iterador para o fim.
+    */
+    const_iterator end() const;
+
+    /*!
+    * \brief Iterador constante para o menor elemento.
+    *
+    * \return iterador constante para o primeiro elemento.
+    */
+    const_iterator cbegin() const;
+
+    /*!
+    * \brief Iterador constante para depois do maior elemento.
+    *
+    * \return iterador constante para o fim.
+    */
+    const_iterator cend() const;
+
+    /*!
+    * \brief Retorna o elemento na posição desejada.
+    *
+    * \param index
+    *
+    * \return elemento da posicao index
+    */
+    const T& at(std::size_t index) const;
+
+    /*!
+    * \brief Introduz o operador []
+    *
+    * \param index
+    *
+    * \return operador[]
+    */
+    const T& operator[](std::size_t index) const;
+
+ private:
+    ArrayList<T> _list;
+    Compare _compare;
+
+    static const auto DEFAULT_MAX = 10u;
+    static constexpr double GROWTH_FACTOR = 2.0;
+};
+
+    template <class T, class Compare>
+    SortedArrayList<T, Compare>::SortedArrayList() :
+        SortedArrayList(DEFAULT_MAX) {}
+
+    template <class T, class Compare>
+    SortedArrayList<T, Compare>::SortedArrayList(std::size_t max,
+                                                 const Compare& compare) :
+        _list(max, GROWTH_FACTOR), _compare(compare) {}
+
+    template <class T, class Compare>
+    template <typename ForwardIt>
+    SortedArrayList<T, Compare> SortedArrayList<T, Compare>::from_sorted_range(
+        ForwardIt first, ForwardIt last, const Compare& compare) {
+        if (!std::is_sorted(first, last, compare)) {
+            throw std::out_of_range("NOT SORTED");
+        }
+        auto count = static_cast<std::size_t>(std::distance(first, last));
+        SortedArrayList list(count > 0 ? count : DEFAULT_MAX, compare);
+        list._list.push_back_range(first, last);
+        return list;
+    }
+
+    template <class T, class Compare>
+    void SortedArrayList<T, Compare>::clear() {
+        _list.clear();
+    }
+
+    template <class T, class Compare>
+    std::size_t SortedArrayList<T, Compare>::insert_sorted(const T& data) {
+        auto index = upper_bound(data);
+        _list.insert(data, index);
+        return index;
+    }
+
+    template <class T, class Compare>
+    std::size_t SortedArrayList<T, Compare>::insert_sorted(T&& data) {
+        auto index = upper_bound(data);
+        _list.insert(std::move(data), index);
+        return index;
+    }
+
+    template <class T, class Compare>
+    template <typename ForwardIt>
+    void SortedArrayList<T, Compare>::insert_sorted_range(ForwardIt first,
+                                                          ForwardIt last) {
+        auto old_size = size();
+        _list.push_back_range(first, last);
+        auto middle = _list.begin() + old_size;
+        std::stable_sort(middle, _list.end(), _compare);
+        std::inplace_merge(_list.begin(), middle, _list.end(), _compare);
+    }
+
+    template <class T, class Compare>
+    T SortedArrayList<T, Compare>::pop(std::size_t index) {
+        return _list.pop(index);
+    }
+
+    template <class T, class Compare>
+    T SortedArrayList<T, Compare>::pop_back() {
+        return _list.pop_back();
+    }
+
+    template <class T, class Compare>
+    T SortedArrayList<T, Compare>::pop_front() {
+        return _list.pop_front();
+    }
+
+    template <class T, class Compare>
+    void SortedArrayList<T, Compare>::remove(const T& data) {
+        if (empty()) {
+            throw std::out_of_range("EMPTY");
+        }
+        auto index = find(data);
+        if (index == size()) {
+            throw std::out_of_range("DO NOT CONTAIN");
+        }
+        _list.pop(index);
+    }
+
+    template <class T, class Compare>
+    void SortedArrayList<T, Compare>::erase_range(std::size_t first,
+                                                  std::size_t last) {
+        _list.erase_range(first, last);
+    }
+
+    template <class T, class Compare>
+    template <typename Predicate>
+    std::size_t SortedArrayList<T, Compare>::erase_if(Predicate pred) {
+        return _list.erase_if(pred);
+    }
+
+    template <class T, class Compare>
+    bool SortedArrayList<T, Compare>::empty() const {
+        return _list.empty();
+    }
+
+    template <class T, class Compare>
+    bool SortedArrayList<T, Compare>::contains(const T& data) const {
+        return find(data) < size();
+    }
+
+    template <class T, class Compare>
+    std::size_t SortedArrayList<T, Compare>::find(const T& data) const {
+        auto index = lower_bound(data);
+        if (index < size() && !_compare(data, _list[index])) {
+            return index;
+        }
+        return size();
+    }
+
+    template <class T, class Compare>
+    std::size_t SortedArrayList<T, Compare>::lower_bound(const T& data) const {
+        return std::lower_bound(begin(), end(), data, _compare) - begin();
+    }
+
+    template <class T, class Compare>
+    std::size_t SortedArrayList<T, Compare>::upper_bound(const T& data) const {
+        return std::upper_bound(begin(), end(), data, _compare) - begin();
+    }
+
+    template <class T, class Compare>
+    std::size_t SortedArrayList<T, Compare>::size() const {
+        return _list.size();
+    }
+
+    template <class T, class Compare>
+    std::size_t SortedArrayList<T, Compare>::max_size() const {
+        return _list.max_size();
+    }
+
+    template <class T, class Compare>
+    void SortedArrayList<T, Compare>::reserve(std::size_t new_cap) {
+        _list.reserve(new_cap);
+    }
+
+    template <class T, class Compare>
+    typename SortedArrayList<T, Compare>::const_iterator
+    SortedArrayList<T, Compare>::begin() const {
+        return _list.begin();
+    }
+
+    template <class T, class Compare>
+    typename SortedArrayList<T, Compare>::const_iterator
+    SortedArrayList<T, Compare>::end() const {
+        return _list.end();
+    }
+
+    template <class T, class Compare>
+    typename SortedArrayList<T, Compare>::const_iterator
+    SortedArrayList<T, Compare>::cbegin() const {
+        return _list.cbegin();
+    }
+
+    template <class T, class Compare>
+    typename SortedArrayList<T, Compare>::const_iterator
+    SortedArrayList<T, Compare>::cend() const {
+        return _list.cend();
+    }
+
+    template <class T, class Compare>
+    const T& SortedArrayList<T, Compare>::at(std::size_t index) const {
+        return _list.at(index);
+    }
+
+    template <class T, class Compare>
+    const T& SortedArrayList<T, Compare>::operator[](std::size_t index) const {
+        return _list.at(index);
+    }
+
+}  // namespace structures
+
+#endif
@@ -0,0 +1,121 @@
+// Copyright [2017] <Luiz Motta>
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <thread>
+
+#include "../array_queue/array_queue.h"
+#include "spsc_array_queue.h"
+
+/**
+ * Vazao entre uma thread produtora e uma consumidora: SpscArrayQueue
+ * contra ArrayQueue protegida por mutex.
+ */
+
+namespace {
+
+constexpr std::size_t CAPACITY = 1u << 16;
+constexpr std::size_t BATCH = 64u;
+
+class MutexArrayQueue {
+ public:
+    bool try_enqueue(std::size_t data) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.full())
+            return false;
+        queue_.enqueue(data);
+        return true;
+    }
+
+    bool try_dequeue(std::size_t& data) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.empty())
+            return false;
+        data = queue_.dequeue();
+        return true;
+    }
+
+ private:
+    std::mutex mutex_;
+    structures::ArrayQueue<std::size_t, true> queue_{CAPACITY};
+};
+
+template<typename Queue>
+void transfer(Queue& queue, std::size_t n) {
+    std::thread producer([&queue, n] {
+        for (std::size_t i = 0; i < n; ++i) {
+            while (!queue.try_enqueue(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    std::size_t data;
+    for (std::size_t i = 0; i < n; ++i) {
+        while (!queue.try_dequeue(data)) {
+            std::this_thread::yield();
+        }
+        benchmark::DoNotOptimize(data);
+    }
+    producer.join();
+}
+
+void transfer_bulk(structures::SpscArrayQueue<std::size_t>& queue,
+                   std::size_t n) {
+    std::thread producer([&queue, n] {
+        std::size_t batch[BATCH];
+        for (std::size_t i = 0; i < n;) {
+            auto count = n - i < BATCH ? n - i : BATCH;
+            for (std::size_t j = 0; j < count; ++j) {
+                batch[j] = i + j;
+            }
+            auto sent = queue.enqueue_bulk(batch, count);
+            if (sent == 0)
+                std::this_thread::yield();
+            i += sent;
+        }
+    });
+    std::size_t batch[BATCH];
+    for (std::size_t i = 0; i < n;) {
+        auto received = queue.dequeue_bulk(batch, BATCH);
+        if (received == 0)
+            std::this_thread::yield();
+        benchmark::DoNotOptimize(batch);
+        i += received;
+    }
+    producer.join();
+}
+
+}  // namespace
+
+static void BM_MutexArrayQueue(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        MutexArrayQueue queue;
+        transfer(queue, n);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void BM_SpscArrayQueue(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        structures::SpscArrayQueue<std::size_t> queue(CAPACITY);
+        transfer(queue, n);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+static void BM_SpscArrayQueueBulk(benchmark::State& state) {
+    auto n = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        structures::SpscArrayQueue<std::size_t> queue(CAPACITY);
+        transfer_bulk(queue, n);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK(BM_MutexArrayQueue)->Arg(1 << 20)->UseRealTime();
+BENCHMARK(BM_SpscArrayQueue)->Arg(1 << 20)->UseRealTime();
+BENCHMARK(BM_SpscArrayQueueBulk)->Arg(1 << 20)->UseRealTime();
+
+BENCHMARK_MAIN();
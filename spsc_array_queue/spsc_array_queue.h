@@ -0,0 +1,343 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_SPSC_ARRAY_QUEUE_H
+#define STRUCTURES_SPSC_ARRAY_QUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace structures {
+
+/*!
+ *  \brief SpscArrayQueue eh uma fila(FIFO) circular sem locks para um unico
+ *  produtor e um unico consumidor.
+ *
+ *  Usa o mesmo armazenamento da ArrayQueue (buffer circular nao
+ *  inicializado, capacidade potencia de dois indexada por mascara). O
+ *  produtor so escreve tail_ e o consumidor so escreve head_, publicados
+ *  com release e lidos com acquire. Cada lado guarda uma copia do indice
+ *  do outro e so a atualiza quando a fila parece cheia/vazia, de modo que
+ *  no caso comum nenhuma linha de cache eh compartilhada.
+ *
+ *  enqueue* so pode ser chamado pela thread produtora e dequeue* so pela
+ *  consumidora; size(), empty() e full() sao aproximados.
+ */
+template<class T>
+class SpscArrayQueue {
+ public:
+    /*!
+     *  \brief Construtor da fila com tamanho padrao.
+     */
+    SpscArrayQueue();
+
+    /*!
+     *  \brief Construtor da fila com tamanho desejado.
+     *
+     *  \param max tamanho maximo, arredondado para potencia de dois.
+     */
+    explicit SpscArrayQueue(std::size_t max);
+
+    SpscArrayQueue(const SpscArrayQueue&) = delete;
+
+    SpscArrayQueue& operator=(const SpscArrayQueue&) = delete;
+
+    /*!
+     *  \brief Destrutor da fila.
+     */
+    ~SpscArrayQueue();
+
+    /*!
+     *  \brief enqueue adiciona um elemento ao final da fila.
+     *
+     *  \param data dado a ser armazenado na fila.
+     */
+    void enqueue(const T& data);
+
+    /*!
+     *  \brief dequeue remove o primeiro elemento da fila.
+     *
+     *  \return o primeiro elemento da fila.
+     */
+    T dequeue();
+
+    /*!
+     *  \brief try_enqueue tenta adicionar um elemento ao final da fila.
+     *
+     *  \param data dado a ser armazenado na fila.
+     *
+     *  \return false se a fila estiver cheia.
+     */
+    bool try_enqueue(const T& data);
+
+    /*!
+     *  \brief try_enqueue tenta adicionar um elemento movendo o dado.
+     *
+     *  \param data dado a ser armazenado na fila.
+     *
+     *  \return false se a fila estiver cheia.
+     */
+    bool try_enqueue(T&& data);
+
+    /*!
+     *  \brief try_emplace tenta construir um elemento no final da fila.
+     *
+     *  \param args argumentos repassados ao construtor de T.
+     *
+     *  \return false se a fila estiver cheia.
+     */
+    template<typename... Args>
+    bool try_emplace(Args&&... args);
+
+    /*!
+     *  \brief try_dequeue tenta remover o primeiro elemento da fila.
+     *
+     *  \param data recebe o elemento removido.
+     *
+     *  \return false se a fila estiver vazia.
+     */
+    bool try_dequeue(T& data);
+
+    /*!
+     *  \brief enqueue_bulk adiciona ate count elementos publicando-os de uma
+     *  vez.
+     *
+     *  \param data primeiro dos elementos a copiar.
+     *  \param count quantidade de elementos.
+     *
+     *  \return quantidade de elementos efetivamente adicionados.
+     */
+    std::size_t enqueue_bulk(const T* data, std::size_t count);
+
+    /*!
+     *  \brief dequeue_bulk remove ate count elementos de uma vez.
+     *
+     *  \param data destino dos elementos removidos.
+     *  \param count quantidade maxima de elementos.
+     *
+     *  \return quantidade de elementos efetivamente removidos.
+     */
+    std::size_t dequeue_bulk(T* data, std::size_t count);
+
+    /*!
+     *  \brief O metodo size mostra a quantidade aproximada de elementos.
+     *
+     *  \return quantidade de elementos da fila.
+     */
+    std::size_t size() const;
+
+    /*!
+     *  \brief O metodo max_size mostra a capacidade da fila.
+     *
+     *  \return capacidade da fila.
+     */
+    std::size_t max_size() const;
+
+    /*!
+     *  \brief O metodo empty mostra se a fila parece vazia.
+     *
+     *  \return true se a fila estiver vazia.
+     */
+    bool empty() const;
+
+    /*!
+     *  \brief O metodo full mostra se a fila parece cheia.
+     *
+     *  \return true se a fila estiver cheia.
+     */
+    bool full() const;
+
+ private:
+    static constexpr std::size_t CACHE_LINE = 64u;
+
+    std::size_t free_slots(std::size_t tail, std::size_t wanted);
+
+    std::size_t used_slots(std::size_t head, std::size_t wanted);
+
+    T* slot(std::size_t index) const { return contents + (index & _mask); }
+
+    static std::size_t round_capacity(std::size_t max);
+
+    static T* allocate(std::size_t count);
+
+    static void deallocate(T* data);
+
+    T* contents;
+    std::size_t _max_size;
+    std::size_t _mask;
+
+    // Linha do consumidor.
+    alignas(CACHE_LINE) std::atomic<std::size_t> _head{0u};
+    std::size_t _cached_tail{0u};
+
+    // Linha do produtor.
+    alignas(CACHE_LINE) std::atomic<std::size_t> _tail{0u};
+    std::size_t _cached_head{0u};
+
+    static const auto DEFAULT_SIZE = 1024u;
+};
+
+template <class T>
+SpscArrayQueue<T>::SpscArrayQueue() : SpscArrayQueue(DEFAULT_SIZE) {}
+
+template <class T>
+SpscArrayQueue<T>::SpscArrayQueue(std::size_t max) {
+    _max_size = round_capacity(max);
+    _mask = _max_size - 1;
+    contents = allocate(_max_size);
+}
+
+template <class T>
+SpscArrayQueue<T>::~SpscArrayQueue() {
+    auto tail = _tail.load(std::memory_order_relaxed);
+    for (auto i = _head.load(std::memory_order_relaxed); i != tail; ++i) {
+        std::destroy_at(slot(i));
+    }
+    deallocate(contents);
+}
+
+template <class T>
+void SpscArrayQueue<T>::enqueue(const T& data) {
+    if (!try_enqueue(data))
+        throw std::out_of_range("full SpscArrayQueue");
+}
+
+template <class T>
+T SpscArrayQueue<T>::dequeue() {
+    auto head = _head.load(std::memory_order_relaxed);
+    if (used_slots(head, 1) == 0)
+        throw std::out_of_range("empty SpscArrayQueue");
+    auto data = std::move(*slot(head));
+    std::destroy_at(slot(head));
+    _head.store(head + 1, std::memory_order_release);
+    return data;
+}
+
+template <class T>
+bool SpscArrayQueue<T>::try_enqueue(const T& data) {
+    return try_emplace(data);
+}
+
+template <class T>
+bool SpscArrayQueue<T>::try_enqueue(T&& data) {
+    return try_emplace(std::move(data));
+}
+
+template <class T>
+template <typename... Args>
+bool SpscArrayQueue<T>::try_emplace(Args&&... args) {
+    auto tail = _tail.load(std::memory_order_relaxed);
+    if (free_slots(tail, 1) == 0)
+        return false;
+    new (slot(tail)) T(std::forward<Args>(args)...);
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+bool SpscArrayQueue<T>::try_dequeue(T& data) {
+    auto head = _head.load(std::memory_order_relaxed);
+    if (used_slots(head, 1) == 0)
+        return false;
+    data = std::move(*slot(head));
+    std::destroy_at(slot(head));
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template <class T>
+std::size_t SpscArrayQueue<T>::enqueue_bulk(const T* data,
+                                            std::size_t count) {
+    auto tail = _tail.load(std::memory_order_relaxed);
+    auto available = free_slots(tail, count);
+    if (count > available)
+        count = available;
+    for (auto i = 0u; i < count; ++i) {
+        new (slot(tail + i)) T(data[i]);
+    }
+    _tail.store(tail + count, std::memory_order_release);
+    return count;
+}
+
+template <class T>
+std::size_t SpscArrayQueue<T>::dequeue_bulk(T* data, std::size_t count) {
+    auto head = _head.load(std::memory_order_relaxed);
+    auto available = used_slots(head, count);
+    if (count > available)
+        count = available;
+    for (auto i = 0u; i < count; ++i) {
+        data[i] = std::move(*slot(head + i));
+        std::destroy_at(slot(head + i));
+    }
+    _head.store(head + count, std::memory_order_release);
+    return count;
+}
+
+template <class T>
+std::size_t SpscArrayQueue<T>::size() const {
+    auto head = _head.load(std::memory_order_acquire);
+    return _tail.load(std::memory_order_acquire) - head;
+}
+
+template <class T>
+std::size_t SpscArrayQueue<T>::max_size() const {
+    return _max_size;
+}
+
+template <class T>
+bool SpscArrayQueue<T>::empty() const {
+    return size() == 0;
+}
+
+template <class T>
+bool SpscArrayQueue<T>::full() const {
+    return size() >= _max_size;
+}
+
+template <class T>
+std::size_t SpscArrayQueue<T>::free_slots(std::size_t tail,
+                                          std::size_t wanted) {
+    auto available = _max_size - (tail - _cached_head);
+    if (available < wanted) {
+        _cached_head = _head.load(std::memory_order_acquire);
+        available = _max_size - (tail - _cached_head);
+    }
+    return available;
+}
+
+template <class T>
+std::size_t SpscArrayQueue<T>::used_slots(std::size_t head,
+                                          std::size_t wanted) {
+    auto available = _cached_tail - head;
+    if (available < wanted) {
+        _cached_tail = _tail.load(std::memory_order_acquire);
+        available = _cached_tail - head;
+    }
+    return available;
+}
+
+template <class T>
+std::size_t SpscArrayQueue<T>::round_capacity(std::size_t max) {
+    std::size_t capacity = 1;
+    while (capacity < max)
+        capacity <<= 1;
+    return capacity;
+}
+
+template <class T>
+T* SpscArrayQueue<T>::allocate(std::size_t count) {
+    return static_cast<T*>(::operator new(count * sizeof(T),
+                                          std::align_val_t{alignof(T)}));
+}
+
+template <class T>
+void SpscArrayQueue<T>::deallocate(T* data) {
+    ::operator delete(data, std::align_val_t{alignof(T)});
+}
+
+}  // namespace structures
+
+#endif
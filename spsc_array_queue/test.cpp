@@ -0,0 +1,151 @@
+/* Copyright [2017] <Luiz Motta> */
+#include <string>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "spsc_array_queue.h"
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+/**
+ * Teste unitario para fila circular de um produtor e um consumidor
+ */
+
+class SpscArrayQueueTest: public ::testing::Test {
+protected:
+    /**
+     * Fila na qual serao efetuadas as operações
+     */
+    structures::SpscArrayQueue<int> queue{8u};
+};
+
+TEST_F(SpscArrayQueueTest, Capacity) {
+    structures::SpscArrayQueue<int> rounded{5u};
+    ASSERT_EQ(8u, rounded.max_size());
+    ASSERT_EQ(8u, queue.max_size());
+}
+
+TEST_F(SpscArrayQueueTest, EmptyAndFull) {
+    int data;
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.try_dequeue(data));
+    ASSERT_THROW(queue.dequeue(), std::out_of_range);
+    for (auto i = 0; i < 8; ++i) {
+        ASSERT_FALSE(queue.full());
+        ASSERT_TRUE(queue.try_enqueue(i));
+    }
+    ASSERT_TRUE(queue.full());
+    ASSERT_EQ(8u, queue.size());
+    ASSERT_FALSE(queue.try_enqueue(8));
+    ASSERT_THROW(queue.enqueue(8), std::out_of_range);
+    for (auto i = 0; i < 8; ++i) {
+        ASSERT_EQ(i, queue.dequeue());
+    }
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.try_dequeue(data));
+}
+
+/**
+ * Enche e esvazia a fila em passos que nao dividem a capacidade, de modo
+ * que os indices e as copias guardadas por cada lado dao varias voltas no
+ * buffer.
+ */
+TEST_F(SpscArrayQueueTest, Wraparound) {
+    auto next_in = 0;
+    auto next_out = 0;
+    for (auto round = 0; round < 100; ++round) {
+        while (queue.try_enqueue(next_in))
+            ++next_in;
+        ASSERT_TRUE(queue.full());
+        for (auto i = 0; i < 3; ++i) {
+            ASSERT_EQ(next_out++, queue.dequeue());
+        }
+        ASSERT_EQ(5u, queue.size());
+        ASSERT_TRUE(queue.try_enqueue(next_in++));
+        int data;
+        while (queue.try_dequeue(data))
+            ASSERT_EQ(next_out++, data);
+        ASSERT_TRUE(queue.empty());
+    }
+    ASSERT_EQ(next_in, next_out);
+}
+
+TEST_F(SpscArrayQueueTest, Bulk) {
+    int in[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    int out[10] = {};
+    ASSERT_EQ(3u, queue.enqueue_bulk(in, 3));
+    ASSERT_EQ(5u, queue.enqueue_bulk(in + 3, 7));
+    ASSERT_EQ(0u, queue.enqueue_bulk(in, 1));
+    ASSERT_EQ(4u, queue.dequeue_bulk(out, 4));
+    // Da a volta no buffer.
+    ASSERT_EQ(2u, queue.enqueue_bulk(in + 8, 2));
+    ASSERT_EQ(6u, queue.dequeue_bulk(out + 4, 10));
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(i, out[i]);
+    }
+    ASSERT_EQ(0u, queue.dequeue_bulk(out, 10));
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST_F(SpscArrayQueueTest, Strings) {
+    structures::SpscArrayQueue<std::string> strings{2u};
+    ASSERT_TRUE(strings.try_enqueue(std::string(64, 'a')));
+    ASSERT_TRUE(strings.try_emplace(3u, 'b'));
+    ASSERT_EQ(std::string(64, 'a'), strings.dequeue());
+    ASSERT_TRUE(strings.try_enqueue(std::string(64, 'c')));
+    // O destrutor destroi "bbb" e a string longa.
+}
+
+/**
+ * Um produtor e um consumidor, alternando operacoes simples e em lote:
+ * cada valor deve sair exatamente uma vez e em ordem.
+ */
+TEST_F(SpscArrayQueueTest, ProducerAndConsumer) {
+    constexpr int total = 200000;
+
+    std::thread producer([this] {
+        int batch[5];
+        for (auto i = 0; i < total;) {
+            if (i % 2 == 0) {
+                if (queue.try_enqueue(i))
+                    ++i;
+                else
+                    std::this_thread::yield();
+                continue;
+            }
+            auto count = total - i < 5 ? total - i : 5;
+            for (auto j = 0; j < count; ++j) {
+                batch[j] = i + j;
+            }
+            auto sent = static_cast<int>(queue.enqueue_bulk(batch, count));
+            if (sent == 0)
+                std::this_thread::yield();
+            i += sent;
+        }
+    });
+
+    auto expected = 0;
+    auto ordered = true;
+    int batch[3];
+    while (expected < total) {
+        std::size_t received;
+        if (expected % 2 == 0) {
+            received = queue.dequeue_bulk(batch, 3);
+        } else {
+            received = queue.try_dequeue(batch[0]) ? 1u : 0u;
+        }
+        if (received == 0)
+            std::this_thread::yield();
+        for (auto i = 0u; i < received; ++i) {
+            if (batch[i] != expected)
+                ordered = false;
+            ++expected;
+        }
+    }
+    producer.join();
+
+    ASSERT_TRUE(ordered);
+    ASSERT_TRUE(queue.empty());
+}
@@ -0,0 +1,189 @@
+/* Copyright [2017] <Luiz Motta> */
+#include <algorithm>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "unrolled_linked_list.h"
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+/**
+ * Teste unitario para lista encadeada desenrolada; com N = 4 quase toda
+ * insercao ou retirada divide ou junta Nodes.
+ */
+
+class UnrolledLinkedListTest: public ::testing::Test {
+protected:
+    using List = structures::UnrolledLinkedList<int,
+                                                structures::HeapAllocator,
+                                                4u>;
+
+    /**
+     * Confere a lista contra o vetor de referencia, pela iteracao e por
+     * at().
+     */
+    template<typename L, typename U>
+    static void expect_equal(const std::vector<U>& expected, L& actual) {
+        ASSERT_EQ(expected.size(), actual.size());
+        ASSERT_EQ(expected.empty(), actual.empty());
+        ASSERT_TRUE(std::equal(expected.begin(), expected.end(),
+                               actual.begin(), actual.end()));
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(expected[i], actual.at(i)) << "index " << i;
+        }
+    }
+
+    /**
+     * Lista na qual serao efetuadas as operações
+     */
+    List list;
+};
+
+TEST_F(UnrolledLinkedListTest, PushAndPop) {
+    std::vector<int> expected;
+    for (auto i = 0; i < 20; ++i) {
+        list.push_back(i);
+        expected.push_back(i);
+        list.push_front(-i);
+        expected.insert(expected.begin(), -i);
+        expect_equal(expected, list);
+    }
+    ASSERT_EQ(expected.front(), list.front());
+    ASSERT_EQ(expected.back(), list.back());
+    while (!expected.empty()) {
+        ASSERT_EQ(expected.back(), list.pop_back());
+        expected.pop_back();
+        if (expected.empty())
+            break;
+        ASSERT_EQ(expected.front(), list.pop_front());
+        expected.erase(expected.begin());
+        expect_equal(expected, list);
+    }
+    ASSERT_TRUE(list.empty());
+    ASSERT_THROW(list.pop_back(), std::out_of_range);
+    ASSERT_THROW(list.pop_front(), std::out_of_range);
+}
+
+TEST_F(UnrolledLinkedListTest, Errors) {
+    ASSERT_THROW(list.insert(1, 1u), std::out_of_range);
+    ASSERT_THROW(list.at(0u), std::out_of_range);
+    ASSERT_THROW(list.pop(0u), std::out_of_range);
+    list.push_back(1);
+    ASSERT_THROW(list.remove(2), std::out_of_range);
+    ASSERT_THROW(list.at(1u), std::out_of_range);
+}
+
+/**
+ * Insercoes, retiradas e remove em posicoes aleatorias, conferindo contra
+ * um std::vector depois de cada operacao.
+ */
+TEST_F(UnrolledLinkedListTest, RandomOperations) {
+    std::mt19937 random{7u};
+    std::vector<int> expected;
+    for (auto step = 0; step < 3000; ++step) {
+        auto op = random() % 4u;
+        if (op < 2u || expected.empty()) {
+            auto index = random() % (expected.size() + 1u);
+            auto value = static_cast<int>(random() % 50u);
+            list.insert(value, index);
+            expected.insert(expected.begin() + index, value);
+        } else if (op == 2u) {
+            auto index = random() % expected.size();
+            ASSERT_EQ(expected[index], list.pop(index));
+            expected.erase(expected.begin() + index);
+        } else {
+            auto value = expected[random() % expected.size()];
+            list.remove(value);
+            expected.erase(std::find(expected.begin(), expected.end(),
+                                     value));
+        }
+        expect_equal(expected, list);
+        if (!expected.empty()) {
+            auto value = expected[random() % expected.size()];
+            auto position = std::find(expected.begin(), expected.end(),
+                                      value) - expected.begin();
+            ASSERT_EQ(static_cast<std::size_t>(position), list.find(value));
+            ASSERT_TRUE(list.contains(value));
+        }
+    }
+    ASSERT_FALSE(list.contains(50));
+    ASSERT_EQ(list.size(), list.find(50));
+}
+
+TEST_F(UnrolledLinkedListTest, InsertSorted) {
+    std::mt19937 random{3u};
+    std::vector<int> expected;
+    for (auto i = 0; i < 200; ++i) {
+        auto value = static_cast<int>(random() % 30u);
+        list.insert_sorted(value);
+        expected.insert(std::upper_bound(expected.begin(), expected.end(),
+                                         value), value);
+    }
+    expect_equal(expected, list);
+}
+
+TEST_F(UnrolledLinkedListTest, InsertOwnElement) {
+    for (auto i = 0; i < 4; ++i) {
+        list.push_back(i);
+    }
+    // Node cheio: o valor eh lido antes de dividir o Node.
+    list.insert(list[3], 1u);
+    expect_equal(std::vector<int>{0, 3, 1, 2, 3}, list);
+}
+
+TEST_F(UnrolledLinkedListTest, CopyAndMove) {
+    structures::UnrolledLinkedList<std::string, structures::HeapAllocator,
+                                   4u> strings;
+    std::vector<std::string> expected;
+    for (auto i = 0; i < 30; ++i) {
+        strings.push_back(std::string(40, static_cast<char>('a' + i % 26)));
+        expected.push_back(std::string(40, static_cast<char>('a' + i % 26)));
+    }
+
+    auto copy = strings;
+    expect_equal(expected, copy);
+    copy.pop(10u);
+    expect_equal(expected, strings);
+
+    auto moved = std::move(copy);
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(29u, moved.size());
+    copy.push_back("again");
+    ASSERT_EQ("again", copy.front());
+
+    moved = strings;
+    expect_equal(expected, moved);
+    strings = std::move(moved);
+    expect_equal(expected, strings);
+
+    copy.swap(strings);
+    expect_equal(expected, copy);
+    ASSERT_EQ(1u, strings.size());
+
+    copy.clear();
+    ASSERT_TRUE(copy.empty());
+    copy.push_front("x");
+    ASSERT_EQ("x", copy.back());
+}
+
+TEST_F(UnrolledLinkedListTest, PoolAllocator) {
+    structures::UnrolledLinkedList<int, structures::PoolAllocator, 4u> pooled;
+    std::vector<int> expected;
+    for (auto round = 0; round < 3; ++round) {
+        for (auto i = 0; i < 50; ++i) {
+            pooled.insert(i, pooled.size() / 2u);
+            expected.insert(expected.begin() + expected.size() / 2u, i);
+        }
+        expect_equal(expected, pooled);
+        while (pooled.size() > 10u) {
+            ASSERT_EQ(expected[3], pooled.pop(3u));
+            expected.erase(expected.begin() + 3);
+        }
+        expect_equal(expected, pooled);
+    }
+}
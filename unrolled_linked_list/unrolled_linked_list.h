@@ -0,0 +1,782 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_UNROLLED_LINKED_LIST_H
+#define STRUCTURES_UNROLLED_LINKED_LIST_H
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../node_pool/node_pool.h"
+#include "../simd_search/simd_search.h"
+
+namespace structures {
+
+/*!
+ * \brief Quantos elementos cabem num Node de cerca de quatro linhas de
+ * cache (no minimo 4).
+ */
+template<typename T>
+constexpr std::size_t unrolled_capacity() {
+    constexpr std::size_t bytes = 256u - 2u * sizeof(void*);
+    return bytes / sizeof(T) > 4u ? bytes / sizeof(T) : 4u;
+}
+
+/*!
+ * \brief Lista encadeada desenrolada: cada Node guarda ate N elementos em
+ * sequencia.
+ *
+ * Tem a mesma interface da LinkedList, mas percorrer a lista toca um Node
+ * a cada N elementos, entao at, find e iteracao andam na velocidade de um
+ * vetor dentro de cada Node. Inserir num Node cheio o divide ao meio;
+ * quando um Node fica com menos da metade apos um pop ele absorve o
+ * proximo se os dois couberem juntos.
+ */
+template<typename T, typename Alloc = HeapAllocator,
+         std::size_t N = unrolled_capacity<T>()>
+class UnrolledLinkedList {
+    class Node;
+
+ public:
+    /*!
+     * \brief Iterador de avanco do inicio para o final da lista.
+     *
+     * U eh T ou const T e M eh Node ou const Node.
+     */
+    template<typename U, typename M>
+    class Iterator {
+     public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = U*;
+        using reference = U&;
+
+        Iterator() = default;
+
+        Iterator(M* node, std::size_t index):
+            node_{node}, index_{index} {}
+
+        template<typename V, typename L, typename = typename std::enable_if<
+            std::is_convertible<L*, M*>::value>::type>
+        Iterator(const Iterator<V, L>& other):  // NOLINT
+            node_{other.node_}, offset_{other.offset_},
+            index_{other.index_} {}
+
+        reference operator*() const { return node_->data()[offset_]; }
+
+        pointer operator->() const { return node_->data() + offset_; }
+
+        Iterator& operator++() {
+            if (++offset_ == node_->count()) {
+                node_ = node_->next();
+                offset_ = 0u;
+            }
+            ++index_;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            auto old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return index_ == other.index_;
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return index_ != other.index_;
+        }
+
+     private:
+        template<typename, typename> friend class Iterator;
+
+        M* node_{nullptr};
+        std::size_t offset_{0u};
+        std::size_t index_{0u};
+    };
+
+    using value_type = T;
+    using iterator = Iterator<T, Node>;
+    using const_iterator = Iterator<const T, const Node>;
+
+    /*!
+     * \brief Construtor da lista vazia
+     */
+    UnrolledLinkedList() = default;
+
+    /*!
+     * \brief Construtor de copia, copia todos os elementos de other
+     */
+    UnrolledLinkedList(const UnrolledLinkedList& other);
+
+    /*!
+     * \brief Construtor de movimento, assume os Nodes de other sem alocar
+     */
+    UnrolledLinkedList(UnrolledLinkedList&& other) noexcept;
+
+    /*!
+     * \brief Atribuicao por copia
+     */
+    UnrolledLinkedList& operator=(const UnrolledLinkedList& other);
+
+    /*!
+     * \brief Atribuicao por movimento
+     */
+    UnrolledLinkedList& operator=(UnrolledLinkedList&& other) noexcept;
+
+    /*!
+     * \brief Destrutor, libera todos os Nodes
+     */
+    ~UnrolledLinkedList();
+
+    /*!
+     * \brief Troca o conteudo com outra lista em O(1)
+     */
+    void swap(UnrolledLinkedList& other) noexcept;
+
+    /*!
+     * \brief Remove todos os elementos
+     */
+    void clear();
+
+    /*!
+     * \brief Coloca um elemento no final da lista
+     *
+     * \param data, dado a ser armazenado
+     */
+    void push_back(const T& data);
+
+    /*!
+     * \brief Coloca um elemento no final da lista, movendo o dado
+     *
+     * \param data, dado a ser armazenado
+     */
+    void push_back(T&& data);
+
+    /*!
+     * \brief Constroi um elemento no final da lista
+     *
+     * \param args, argumentos repassados ao construtor de T
+     *
+     * \return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace_back(Args&&... args);
+
+    /*!
+     * \brief Coloca um elemento no inicio da lista
+     *
+     * \param data, dado a ser armazenado
+     */
+    void push_front(const T& data);
+
+    /*!
+     * \brief Coloca um elemento no inicio da lista, movendo o dado
+     *
+     * \param data, dado a ser armazenado
+     */
+    void push_front(T&& data);
+
+    /*!
+     * \brief Constroi um elemento no inicio da lista
+     *
+     * \param args, argumentos repassados ao construtor de T
+     *
+     * \return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace_front(Args&&... args);
+
+    /*!
+     * \brief Coloca um elemento na posicao index
+     *
+     * \param data, dado a ser armazenado
+     * \param index, posicao, de 0 ate size()
+     */
+    void insert(const T& data, std::size_t index);
+
+    /*!
+     * \brief Coloca um elemento na posicao index, movendo o dado
+     *
+     * \param data, dado a ser armazenado
+     * \param index, posicao, de 0 ate size()
+     */
+    void insert(T&& data, std::size_t index);
+
+    /*!
+     * \brief Constroi um elemento na posicao index
+     *
+     * \param index, posicao, de 0 ate size()
+     * \param args, argumentos repassados ao construtor de T
+     *
+     * \return referencia do elemento construido
+     */
+    template<typename... Args>
+    T& emplace(std::size_t index, Args&&... args);
+
+    /*!
+     * \brief Coloca um elemento antes do primeiro elemento nao menor que
+     * ele; a lista deve estar ordenada
+     *
+     * \param data, dado a ser armazenado
+     */
+    void insert_sorted(const T& data);
+
+    /*!
+     * \brief Acessa o elemento na posicao index
+     *
+     * \return referencia do elemento
+     */
+    T& at(std::size_t index);
+
+    /*!
+     * \brief Retira o elemento na posicao index
+     *
+     * \return o dado retirado
+     */
+    T pop(std::size_t index);
+
+    /*!
+     * \brief Retira o ultimo elemento
+     *
+     * \return o dado retirado
+     */
+    T pop_back();
+
+    /*!
+     * \brief Retira o primeiro elemento
+     *
+     * \return o dado retirado
+     */
+    T pop_front();
+
+    /*!
+     * \brief Retira a primeira ocorrencia de data
+     *
+     * \param data, dado a ser retirado
+     */
+    void remove(const T& data);
+
+    /*!
+     * \brief Verifica se a lista esta vazia
+     *
+     * \return true caso a lista esteja vazia
+     */
+    bool empty() const;
+
+    /*!
+     * \brief Verifica se a lista contem data
+     *
+     * \return true caso data esteja na lista
+     */
+    bool contains(const T& data) const;
+
+    /*!
+     * \brief Procura a primeira ocorrencia de data
+     *
+     * \return posicao do dado, ou size() se nao houver
+     */
+    std::size_t find(const T& data) const;
+
+    /*!
+     * \brief Passa o tamanho da lista
+     *
+     * \return tamanho da lista
+     */
+    std::size_t size() const;
+
+    /*!
+     * \brief Acessa o elemento na posicao index
+     *
+     * \return referencia do elemento
+     */
+    T& operator[](std::size_t index);
+
+    /*!
+     * \brief Acessa o primeiro elemento da lista
+     *
+     * \return referencia do primeiro elemento
+     */
+    T& front();
+
+    /*!
+     * \brief Acessa o ultimo elemento da lista em O(1)
+     *
+     * \return referencia do ultimo elemento
+     */
+    T& back();
+
+    /*!
+     * \brief Iterador para o primeiro elemento
+     *
+     * \return iterador para o primeiro elemento
+     */
+    iterator begin();
+
+    /*!
+     * \brief Iterador constante para o primeiro elemento
+     *
+     * \return iterador constante para o primeiro elemento
+     */
+    const_iterator begin() const;
+
+    /*!
+     * \brief Iterador constante para o primeiro elemento
+     *
+     * \return iterador constante para o primeiro elemento
+     */
+    const_iterator cbegin() const;
+
+    /*!
+     * \brief Iterador para depois do ultimo elemento
+     *
+     * \return iterador para o fim
+     */
+    iterator end();
+
+    /*!
+     * \brief Iterador constante para depois do ultimo elemento
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator end() const;
+
+    /*!
+     * \brief Iterador constante para depois do ultimo elemento
+     *
+     * \return iterador constante para o fim
+     */
+    const_iterator cend() const;
+
+ private:
+    class Node {
+     public:
+        Node() = default;
+
+        Node(const Node&) = delete;
+
+        Node& operator=(const Node&) = delete;
+
+        ~Node() { std::destroy(data(), data() + count_); }
+
+        T* data() { return std::launder(reinterpret_cast<T*>(storage_)); }
+
+        const T* data() const {
+            return std::launder(reinterpret_cast<const T*>(storage_));
+        }
+
+        std::size_t count() const { return count_; }
+
+        bool full() const { return count_ == N; }
+
+        Node* next() { return next_; }
+
+        const Node* next() const { return next_; }
+
+        void next(Node* node) { next_ = node; }
+
+        template<typename... Args>
+        T& emplace(std::size_t offset, Args&&... args) {
+            auto contents = data();
+            if (offset == count_) {
+                new (contents + count_) T(std::forward<Args>(args)...);
+            } else {
+                T value(std::forward<Args>(args)...);
+                new (contents + count_) T(std::move(contents[count_ - 1]));
+                std::move_backward(contents + offset, contents + count_ - 1,
+                                   contents + count_);
+                contents[offset] = std::move(value);
+            }
+            ++count_;
+            return contents[offset];
+        }
+
+        T erase(std::size_t offset) {
+            auto contents = data();
+            auto value = std::move(contents[offset]);
+            std::move(contents + offset + 1, contents + count_,
+                      contents + offset);
+            std::destroy_at(contents + count_ - 1);
+            --count_;
+            return value;
+        }
+
+        /*!
+         * \brief Move os elementos de [from, count) para o final de other.
+         */
+        void move_to(Node* other, std::size_t from) {
+            auto contents = data();
+            std::uninitialized_move(contents + from, contents + count_,
+                                    other->data() + other->count_);
+            std::destroy(contents + from, contents + count_);
+            other->count_ += count_ - from;
+            count_ = from;
+        }
+
+     private:
+        std::size_t count_{0u};
+        Node* next_{nullptr};
+        alignas(T) unsigned char storage_[N * sizeof(T)];
+    };
+
+    Node* new_node_after(Node* node);
+
+    template<typename... Args>
+    T& emplace_at(Node* node, std::size_t offset, Args&&... args);
+
+    Node* nodeAt(std::size_t& index, Node** prev = nullptr) {
+        auto it = head;
+        while (index >= it->count()) {
+            index -= it->count();
+            if (prev != nullptr)
+                *prev = it;
+            it = it->next();
+        }
+        return it;
+    }
+
+    typename Alloc::template rebind<Node> alloc_;
+    Node* head{nullptr};
+    Node* tail{nullptr};
+    std::size_t size_{0u};
+};
+
+    template<typename T, typename Alloc, std::size_t N>
+    UnrolledLinkedList<T, Alloc, N>::UnrolledLinkedList(
+        const UnrolledLinkedList& other) :
+        alloc_{other.alloc_}
+    {
+        try {
+            for (auto& data : other)
+                push_back(data);
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    UnrolledLinkedList<T, Alloc, N>::UnrolledLinkedList(
+        UnrolledLinkedList&& other) noexcept :
+        alloc_{std::move(other.alloc_)},
+        head{std::exchange(other.head, nullptr)},
+        tail{std::exchange(other.tail, nullptr)},
+        size_{std::exchange(other.size_, 0u)}
+    {}
+
+    template<typename T, typename Alloc, std::size_t N>
+    UnrolledLinkedList<T, Alloc, N>&
+    UnrolledLinkedList<T, Alloc, N>::operator=(
+        const UnrolledLinkedList& other) {
+        if (this != &other) {
+            UnrolledLinkedList copy{other};
+            swap(copy);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    UnrolledLinkedList<T, Alloc, N>&
+    UnrolledLinkedList<T, Alloc, N>::operator=(
+        UnrolledLinkedList&& other) noexcept {
+        if (this != &other) {
+            UnrolledLinkedList moved{std::move(other)};
+            swap(moved);
+        }
+        return *this;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    UnrolledLinkedList<T, Alloc, N>::~UnrolledLinkedList() { clear(); }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void UnrolledLinkedList<T, Alloc, N>::swap(
+        UnrolledLinkedList& other) noexcept {
+        std::swap(alloc_, other.alloc_);
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(size_, other.size_);
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void UnrolledLinkedList<T, Alloc, N>::clear() {
+        while (head != nullptr) {
+            auto to_delete = head;
+            head = head->next();
+            alloc_.destroy(to_delete);
+        }
+        tail = nullptr;
+        size_ = 0u;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void UnrolledLinkedList<T, Alloc, N>::push_back(const T& data) {
+        emplace_back(data);
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void UnrolledLinkedList<T, Alloc, N>::push_back(T&& data) {
+        emplace_back(std::move(data));
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    template<typename... Args>
+    T& UnrolledLinkedList<T, Alloc, N>::emplace_back(Args&&... args) {
+        if (tail == nullptr || tail->full())
+            new_node_after(tail);
+        auto& data = tail->emplace(tail->count(), std::forward<Args>(args)...);
+        ++size_;
+        return data;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void UnrolledLinkedList<T, Alloc, N>::push_front(const T& data) {
+        emplace_front(data);
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void UnrolledLinkedList<T, Alloc, N>::push_front(T&& data) {
+        emplace_front(std::move(data));
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    template<typename... Args>
+    T& UnrolledLinkedList<T, Alloc, N>::emplace_front(Args&&... args) {
+        if (head == nullptr || head->full())
+            new_node_after(nullptr);
+        auto& data = head->emplace(0u, std::forward<Args>(args)...);
+        ++size_;
+        return data;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void UnrolledLinkedList<T, Alloc, N>::insert(const T& data,
+                                                 std::size_t index) {
+        emplace(index, data);
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void UnrolledLinkedList<T, Alloc, N>::insert(T&& data,
+                                                 std::size_t index) {
+        emplace(index, std::move(data));
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    template<typename... Args>
+    T& UnrolledLinkedList<T, Alloc, N>::emplace(std::size_t index,
+                                                Args&&... args) {
+        if (index > size_)
+            throw std::out_of_range("INDEX OUT OF BOUNDS INSERT");
+        if (index == 0u)
+            return emplace_front(std::forward<Args>(args)...);
+        if (index == size_)
+            return emplace_back(std::forward<Args>(args)...);
+        auto node = nodeAt(index);
+        return emplace_at(node, index, std::forward<Args>(args)...);
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void UnrolledLinkedList<T, Alloc, N>::insert_sorted(const T& data) {
+        // Primeiro Node cujo ultimo elemento nao eh menor que data.
+        auto it = head;
+        while (it != nullptr && it->data()[it->count() - 1] < data) {
+            it = it->next();
+        }
+        if (it == nullptr)
+            return push_back(data);
+        auto position = std::lower_bound(it->data(), it->data() + it->count(),
+                                         data);
+        emplace_at(it, position - it->data(), data);
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    T& UnrolledLinkedList<T, Alloc, N>::at(std::size_t index) {
+        if (index >= size_)
+            throw std::out_of_range("INDEX OUT OF BOUNDS AT");
+        auto node = nodeAt(index);
+        return node->data()[index];
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    T UnrolledLinkedList<T, Alloc, N>::pop(std::size_t index) {
+        if (index >= size_)
+            throw std::out_of_range("INDEX OUT OF BOUNDS POP");
+        Node* prev = nullptr;
+        auto node = nodeAt(index, &prev);
+        auto data = node->erase(index);
+        --size_;
+        if (node->count() == 0u) {
+            if (prev == nullptr)
+                head = node->next();
+            else
+                prev->next(node->next());
+            if (node == tail)
+                tail = prev;
+            alloc_.destroy(node);
+        } else if (node->count() < N / 2u && node->next() != nullptr &&
+                   node->count() + node->next()->count() <= N) {
+            auto next = node->next();
+            next->move_to(node, 0u);
+            node->next(next->next());
+            if (next == tail)
+                tail = node;
+            alloc_.destroy(next);
+        }
+        return data;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    T UnrolledLinkedList<T, Alloc, N>::pop_back() {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        return pop(size_ - 1u);
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    T UnrolledLinkedList<T, Alloc, N>::pop_front() {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        return pop(0u);
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    void UnrolledLinkedList<T, Alloc, N>::remove(const T& data) {
+        auto index = find(data);
+        if (index == size_)
+            throw std::out_of_range("NOT FOUND");
+        pop(index);
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    bool UnrolledLinkedList<T, Alloc, N>::empty() const {
+        return size() == 0u;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    bool UnrolledLinkedList<T, Alloc, N>::contains(const T& data) const {
+        return find(data) != size_;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    std::size_t UnrolledLinkedList<T, Alloc, N>::find(const T& data) const {
+        std::size_t index = 0u;
+        for (const Node* it = head; it != nullptr; it = it->next()) {
+            auto offset = simd::find(it->data(), it->count(), data);
+            if (offset != it->count())
+                return index + offset;
+            index += it->count();
+        }
+        return index;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    std::size_t UnrolledLinkedList<T, Alloc, N>::size() const {
+        return size_;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    T& UnrolledLinkedList<T, Alloc, N>::operator[](std::size_t index) {
+        return at(index);
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    T& UnrolledLinkedList<T, Alloc, N>::front() {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        return head->data()[0];
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    T& UnrolledLinkedList<T, Alloc, N>::back() {
+        if (empty())
+            throw std::out_of_range("EMPTY");
+        return tail->data()[tail->count() - 1u];
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename UnrolledLinkedList<T, Alloc, N>::iterator
+    UnrolledLinkedList<T, Alloc, N>::begin() {
+        return iterator{head, 0u};
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename UnrolledLinkedList<T, Alloc, N>::const_iterator
+    UnrolledLinkedList<T, Alloc, N>::begin() const {
+        return const_iterator{head, 0u};
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename UnrolledLinkedList<T, Alloc, N>::const_iterator
+    UnrolledLinkedList<T, Alloc, N>::cbegin() const {
+        return begin();
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename UnrolledLinkedList<T, Alloc, N>::iterator
+    UnrolledLinkedList<T, Alloc, N>::end() {
+        return iterator{nullptr, size_};
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename UnrolledLinkedList<T, Alloc, N>::const_iterator
+    UnrolledLinkedList<T, Alloc, N>::end() const {
+        return const_iterator{nullptr, size_};
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename UnrolledLinkedList<T, Alloc, N>::const_iterator
+    UnrolledLinkedList<T, Alloc, N>::cend() const {
+        return end();
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    typename UnrolledLinkedList<T, Alloc, N>::Node*
+    UnrolledLinkedList<T, Alloc, N>::new_node_after(Node* node) {
+        auto new_node = alloc_.create();
+        if (node == nullptr) {
+            new_node->next(head);
+            head = new_node;
+        } else {
+            new_node->next(node->next());
+            node->next(new_node);
+        }
+        if (tail == node)
+            tail = new_node;
+        return new_node;
+    }
+
+    template<typename T, typename Alloc, std::size_t N>
+    template<typename... Args>
+    T& UnrolledLinkedList<T, Alloc, N>::emplace_at(Node* node,
+                                                   std::size_t offset,
+                                                   Args&&... args) {
+        if (node->full()) {
+            // Constroi antes de dividir: args pode referenciar um elemento
+            // que move_to vai mover.
+            T value(std::forward<Args>(args)...);
+            auto half = new_node_after(node);
+            node->move_to(half, N / 2u);
+            if (offset > node->count()) {
+                offset -= node->count();
+                node = half;
+            }
+            auto& data = node->emplace(offset, std::move(value));
+            ++size_;
+            return data;
+        }
+        auto& data = node->emplace(offset, std::forward<Args>(args)...);
+        ++size_;
+        return data;
+    }
+
+}  // namespace structures
+
+#endif
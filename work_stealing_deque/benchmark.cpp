@@ -0,0 +1,109 @@
+// Copyright [2017] <Luiz Motta>
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "../doubly_linked_list/doubly_linked_list.h"
+#include "work_stealing_deque.h"
+
+/**
+ * Uma thread dona empilha tarefas e desempilha metade delas enquanto 0 a
+ * N ladroes roubam do outro lado: WorkStealingDeque contra um deque feito
+ * de DoublyLinkedList protegida por mutex.
+ */
+
+namespace {
+
+int max_thieves() {
+    auto n = static_cast<int>(std::thread::hardware_concurrency());
+    return n < 2 ? 1 : n - 1;
+}
+
+/*!
+ * \brief DoublyLinkedList com a interface do WorkStealingDeque.
+ */
+class MutexDeque {
+ public:
+    void push(int data) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        list_.push_back(data);
+    }
+
+    std::optional<int> pop() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (list_.empty())
+            return std::nullopt;
+        return list_.pop_back();
+    }
+
+    std::optional<int> steal() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (list_.empty())
+            return std::nullopt;
+        return list_.pop_front();
+    }
+
+ private:
+    std::mutex mutex_;
+    structures::DoublyLinkedList<int> list_;
+};
+
+}  // namespace
+
+template<typename Deque>
+static void BM_OwnerAndThieves(benchmark::State& state) {
+    constexpr auto tasks = 1 << 14;
+    Deque deque;
+    std::atomic<bool> running{true};
+    std::atomic<std::int64_t> stolen{0};
+
+    std::vector<std::thread> thieves;
+    for (auto t = 0; t < state.range(0); ++t) {
+        thieves.emplace_back([&] {
+            while (running.load(std::memory_order_relaxed)) {
+                auto data = deque.steal();
+                if (!data) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                benchmark::DoNotOptimize(*data);
+                stolen.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    std::int64_t popped = 0;
+    std::int64_t expected = 0;
+    for (auto _ : state) {
+        for (auto i = 0; i < tasks; ++i) {
+            deque.push(i);
+            if (i % 2 == 1 && deque.pop())
+                ++popped;
+        }
+        while (deque.pop())
+            ++popped;
+        // Espera os ladroes terminarem o que ja levaram.
+        expected += tasks;
+        while (popped + stolen.load(std::memory_order_relaxed) < expected)
+            std::this_thread::yield();
+    }
+
+    running = false;
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+    state.SetItemsProcessed(expected);
+    state.counters["stolen"] = benchmark::Counter(
+        static_cast<double>(stolen.load()) / static_cast<double>(expected));
+}
+
+BENCHMARK_TEMPLATE(BM_OwnerAndThieves, structures::WorkStealingDeque<int>)
+    ->DenseRange(0, max_thieves())->UseRealTime();
+BENCHMARK_TEMPLATE(BM_OwnerAndThieves, MutexDeque)
+    ->DenseRange(0, max_thieves())->UseRealTime();
+
+BENCHMARK_MAIN();
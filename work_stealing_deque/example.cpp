@@ -0,0 +1,136 @@
+// Copyright [2017] <Luiz Motta>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "work_stealing_deque.h"
+
+/**
+ * Exemplo: um pool de threads com um WorkStealingDeque por thread
+ * calculando fibonacci com tarefas recursivas (fork/join).
+ *
+ * Cada tarefa criada vai para o deque da thread que a criou; uma thread
+ * sem trabalho rouba a tarefa mais antiga de outra, que costuma ser a
+ * maior subarvore. Quem espera por uma tarefa filha executa outras
+ * tarefas enquanto isso, entao nenhuma thread fica bloqueada.
+ */
+
+namespace {
+
+/*!
+ * \brief Tarefa com um contador de pendencias que eh decrementado quando
+ * ela termina.
+ */
+struct Task {
+    std::function<void()> work;
+    std::atomic<int>* pending;
+};
+
+class ThreadPool {
+ public:
+    /*!
+     * \brief Cria threads - 1 threads; a thread que chama run eh a outra.
+     */
+    explicit ThreadPool(std::size_t threads) {
+        for (auto i = 0u; i < threads; ++i) {
+            deques_.push_back(
+                std::make_unique<structures::WorkStealingDeque<Task*>>());
+        }
+        for (auto i = 1u; i < threads; ++i) {
+            workers_.emplace_back([this, i] {
+                self_ = i;
+                while (!stop_.load(std::memory_order_acquire)) {
+                    if (!run_one())
+                        std::this_thread::yield();
+                }
+            });
+        }
+    }
+
+    ~ThreadPool() {
+        stop_.store(true, std::memory_order_release);
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    /*!
+     * \brief Coloca a tarefa no deque da thread atual.
+     */
+    void spawn(Task* task) { deques_[self_]->push(task); }
+
+    /*!
+     * \brief Executa tarefas ate que pending chegue a zero.
+     */
+    void wait(const std::atomic<int>& pending) {
+        while (pending.load(std::memory_order_acquire) > 0) {
+            if (!run_one())
+                std::this_thread::yield();
+        }
+    }
+
+ private:
+    bool run_one() {
+        auto task = deques_[self_]->pop();
+        if (!task) {
+            // Vitima pseudo-aleatoria, para os ladroes nao disputarem o
+            // mesmo deque.
+            thread_local std::uint32_t seed = 2463534242u + self_;
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            auto victim = seed % deques_.size();
+            if (victim == self_)
+                return false;
+            task = deques_[victim]->steal();
+            if (!task)
+                return false;
+        }
+        (*task)->work();
+        (*task)->pending->fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    static thread_local std::size_t self_;
+
+    std::vector<std::unique_ptr<structures::WorkStealingDeque<Task*>>>
+        deques_;
+    std::vector<std::thread> workers_;
+    std::atomic<bool> stop_{false};
+};
+
+thread_local std::size_t ThreadPool::self_ = 0u;
+
+std::uint64_t serial_fib(int n) {
+    return n < 2 ? n : serial_fib(n - 1) + serial_fib(n - 2);
+}
+
+std::uint64_t fib(ThreadPool& pool, int n) {
+    if (n < 20)
+        return serial_fib(n);
+    std::uint64_t left = 0u;
+    std::atomic<int> pending{1};
+    Task task{[&] { left = fib(pool, n - 1); }, &pending};
+    pool.spawn(&task);
+    auto right = fib(pool, n - 2);
+    pool.wait(pending);
+    return left + right;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    auto n = argc > 1 ? std::atoi(argv[1]) : 36;
+    auto threads = argc > 2 ? std::atoi(argv[2])
+                            : static_cast<int>(
+                                  std::thread::hardware_concurrency());
+    ThreadPool pool{threads > 0 ? static_cast<std::size_t>(threads) : 1u};
+    std::printf("fib(%d) = %llu\n", n,
+                static_cast<unsigned long long>(fib(pool, n)));  // NOLINT
+    return 0;
+}
@@ -0,0 +1,112 @@
+/* Copyright [2017] <Luiz Motta> */
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "work_stealing_deque.h"
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+/**
+ * Teste unitario para o deque de roubo de trabalho
+ */
+
+class WorkStealingDequeTest: public ::testing::Test {
+protected:
+    /**
+     * Deque no qual serao efetuadas as operações
+     */
+    structures::WorkStealingDeque<int> deque{4u};
+};
+
+TEST_F(WorkStealingDequeTest, Empty) {
+    ASSERT_TRUE(deque.empty());
+    ASSERT_FALSE(deque.pop().has_value());
+    ASSERT_FALSE(deque.steal().has_value());
+}
+
+TEST_F(WorkStealingDequeTest, PopIsLifoStealIsFifo) {
+    for (auto i = 0; i < 10; ++i) {
+        deque.push(i);
+    }
+    ASSERT_EQ(10u, deque.size());
+    ASSERT_EQ(0, *deque.steal());
+    ASSERT_EQ(9, *deque.pop());
+    ASSERT_EQ(1, *deque.steal());
+    ASSERT_EQ(8, *deque.pop());
+    ASSERT_EQ(6u, deque.size());
+}
+
+TEST_F(WorkStealingDequeTest, Grow) {
+    ASSERT_EQ(4u, deque.capacity());
+    for (auto i = 0; i < 3; ++i) {
+        deque.push(i);
+    }
+    // Desloca top para que o vetor cresca com os elementos dando a volta.
+    ASSERT_EQ(0, *deque.steal());
+    ASSERT_EQ(1, *deque.steal());
+    for (auto i = 3; i < 100; ++i) {
+        deque.push(i);
+    }
+    ASSERT_EQ(128u, deque.capacity());
+    for (auto i = 99; i >= 2; --i) {
+        ASSERT_EQ(i, *deque.pop());
+    }
+    ASSERT_TRUE(deque.empty());
+}
+
+/**
+ * A thread dona empilha e desempilha enquanto os ladroes roubam: cada
+ * valor deve ser consumido exatamente uma vez, inclusive na disputa pelo
+ * ultimo elemento e enquanto o vetor cresce.
+ */
+TEST_F(WorkStealingDequeTest, OwnerAndThieves) {
+    constexpr int thieves = 4;
+    constexpr int total = 200000;
+
+    std::vector<std::atomic<int>> seen(total);
+    std::atomic<int> consumed{0};
+
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < thieves; ++t) {
+        threads.emplace_back([&] {
+            while (consumed.load() < total) {
+                auto data = deque.steal();
+                if (!data) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                seen[*data].fetch_add(1);
+                consumed.fetch_add(1);
+            }
+        });
+    }
+    for (auto i = 0; i < total; ++i) {
+        deque.push(i);
+        if (i % 3 == 0) {
+            auto data = deque.pop();
+            if (data) {
+                seen[*data].fetch_add(1);
+                consumed.fetch_add(1);
+            }
+        }
+    }
+    while (consumed.load() < total) {
+        auto data = deque.pop();
+        if (data) {
+            seen[*data].fetch_add(1);
+            consumed.fetch_add(1);
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto i = 0; i < total; ++i) {
+        ASSERT_EQ(1, seen[i].load()) << "value " << i;
+    }
+    ASSERT_TRUE(deque.empty());
+}
@@ -0,0 +1,265 @@
+// Copyright [2017] <Luiz Motta>
+
+#ifndef STRUCTURES_WORK_STEALING_DEQUE_H
+#define STRUCTURES_WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace structures {
+
+/*!
+ * \brief WorkStealingDeque implementa o deque de Chase-Lev para
+ * escalonadores de tarefas.
+ *
+ * Uma unica thread dona usa o deque como pilha no final (push e pop em
+ * bottom) e qualquer outra thread rouba do inicio (steal em top), como um
+ * DoublyCircularList em que cada extremidade tem um unico tipo de
+ * usuario. push e pop so disputam com os ladroes quando resta um
+ * elemento; steal eh um unico CAS em top.
+ *
+ * O vetor circular dobra quando enche. Os vetores antigos ficam guardados
+ * ate o destrutor, porque um ladrao ainda pode estar lendo deles; como os
+ * tamanhos dobram, isso no maximo duplica a memoria.
+ *
+ * Ordens de memoria de Le, Pop, Cohen e Zappa Nardelli, "Correct and
+ * efficient work-stealing for weak memory models" (PPoPP 2013). Os
+ * elementos sao lidos antes do CAS que decide quem ficou com eles, entao
+ * T tem que ser trivialmente copiavel (tipicamente um ponteiro para a
+ * tarefa).
+ */
+template<typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "WorkStealingDeque<T> requires a trivially copyable T");
+
+ public:
+    /*!
+     * \brief Construtor do deque com capacidade inicial padrao
+     */
+    WorkStealingDeque();
+
+    /*!
+     * \brief Construtor do deque com capacidade inicial desejada
+     *
+     * \param capacity capacidade inicial, arredondada para potencia de dois
+     */
+    explicit WorkStealingDeque(std::size_t capacity);
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /*!
+     * \brief Destrutor; nao pode haver outras threads usando o deque
+     */
+    ~WorkStealingDeque();
+
+    /*!
+     * \brief Coloca um elemento no final; so a thread dona
+     *
+     * \param data, dado a ser armazenado
+     */
+    void push(T data);
+
+    /*!
+     * \brief Retira o ultimo elemento colocado; so a thread dona
+     *
+     * \return o dado retirado, ou std::nullopt se o deque estiver vazio
+     */
+    std::optional<T> pop();
+
+    /*!
+     * \brief Rouba o elemento mais antigo; qualquer thread
+     *
+     * \return o dado roubado, ou std::nullopt se o deque estiver vazio ou
+     * outra thread levou o elemento primeiro
+     */
+    std::optional<T> steal();
+
+    /*!
+     * \brief Verifica se o deque esta vazio
+     *
+     * \return true caso o deque pareca vazio no momento da chamada
+     */
+    bool empty() const;
+
+    /*!
+     * \brief Passa o tamanho aproximado do deque
+     *
+     * \return quantidade de elementos no momento da chamada
+     */
+    std::size_t size() const;
+
+    /*!
+     * \brief Passa a capacidade do vetor circular atual
+     *
+     * \return capacidade do vetor
+     */
+    std::size_t capacity() const;
+
+ private:
+    /*!
+     * \brief Vetor circular de capacidade potencia de dois, indexado pelas
+     * posicoes absolutas de top e bottom.
+     */
+    class Ring {
+     public:
+        explicit Ring(std::size_t capacity):
+            capacity_{capacity},
+            mask_{capacity - 1u},
+            slots_{new std::atomic<T>[capacity]}
+        {}
+
+        Ring(const Ring&) = delete;
+
+        Ring& operator=(const Ring&) = delete;
+
+        ~Ring() { delete[] slots_; }
+
+        std::size_t capacity() const { return capacity_; }
+
+        T get(std::int64_t index) const {
+            return slots_[index & mask_].load(std::memory_order_relaxed);
+        }
+
+        void put(std::int64_t index, T data) {
+            slots_[index & mask_].store(data, std::memory_order_relaxed);
+        }
+
+        /*!
+         * \brief Copia [top, bottom) para um vetor com o dobro do tamanho.
+         */
+        Ring* grow(std::int64_t top, std::int64_t bottom) const {
+            auto ring = new Ring(capacity_ * 2u);
+            for (auto i = top; i != bottom; ++i) {
+                ring->put(i, get(i));
+            }
+            ring->previous_ = this;
+            return ring;
+        }
+
+        const Ring* previous() const { return previous_; }
+
+     private:
+        std::size_t capacity_;
+        std::size_t mask_;
+        std::atomic<T>* slots_;
+        const Ring* previous_{nullptr};
+    };
+
+    static std::size_t round_capacity(std::size_t capacity);
+
+    static constexpr std::size_t CACHE_LINE = 64u;
+
+    static const auto DEFAULT_SIZE = 64u;
+
+    // top eh disputado pelos ladroes; bottom e ring so sao escritos pela
+    // thread dona.
+    alignas(CACHE_LINE) std::atomic<std::int64_t> top_{0};
+    alignas(CACHE_LINE) std::atomic<std::int64_t> bottom_{0};
+    std::atomic<Ring*> ring_;
+};
+
+    template<typename T>
+    WorkStealingDeque<T>::WorkStealingDeque() :
+        WorkStealingDeque(DEFAULT_SIZE)
+    {}
+
+    template<typename T>
+    WorkStealingDeque<T>::WorkStealingDeque(std::size_t capacity) :
+        ring_{new Ring(round_capacity(capacity))}
+    {}
+
+    template<typename T>
+    WorkStealingDeque<T>::~WorkStealingDeque() {
+        const Ring* ring = ring_.load(std::memory_order_relaxed);
+        while (ring != nullptr) {
+            auto previous = ring->previous();
+            delete ring;
+            ring = previous;
+        }
+    }
+
+    template<typename T>
+    void WorkStealingDeque<T>::push(T data) {
+        auto bottom = bottom_.load(std::memory_order_relaxed);
+        auto top = top_.load(std::memory_order_acquire);
+        auto ring = ring_.load(std::memory_order_relaxed);
+        if (bottom - top > static_cast<std::int64_t>(ring->capacity()) - 1) {
+            ring = ring->grow(top, bottom);
+            ring_.store(ring, std::memory_order_release);
+        }
+        ring->put(bottom, data);
+        // O artigo usa uma fence release e um store relaxed; o store
+        // release tem o mesmo custo e o ThreadSanitizer o entende.
+        bottom_.store(bottom + 1, std::memory_order_release);
+    }
+
+    template<typename T>
+    std::optional<T> WorkStealingDeque<T>::pop() {
+        auto bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        auto ring = ring_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto top = top_.load(std::memory_order_relaxed);
+        if (top > bottom) {
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+        std::optional<T> data{ring->get(bottom)};
+        if (top == bottom) {
+            // Ultimo elemento: disputa com os ladroes pelo mesmo top.
+            if (!top_.compare_exchange_strong(top, top + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed))
+                data.reset();
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return data;
+    }
+
+    template<typename T>
+    std::optional<T> WorkStealingDeque<T>::steal() {
+        auto top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto bottom = bottom_.load(std::memory_order_acquire);
+        if (top >= bottom)
+            return std::nullopt;
+        auto ring = ring_.load(std::memory_order_acquire);
+        auto data = ring->get(top);
+        if (!top_.compare_exchange_strong(top, top + 1,
+                                          std::memory_order_seq_cst,
+                                          std::memory_order_relaxed))
+            return std::nullopt;
+        return data;
+    }
+
+    template<typename T>
+    bool WorkStealingDeque<T>::empty() const { return size() == 0u; }
+
+    template<typename T>
+    std::size_t WorkStealingDeque<T>::size() const {
+        auto bottom = bottom_.load(std::memory_order_relaxed);
+        auto top = top_.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<std::size_t>(bottom - top) : 0u;
+    }
+
+    template<typename T>
+    std::size_t WorkStealingDeque<T>::capacity() const {
+        return ring_.load(std::memory_order_relaxed)->capacity();
+    }
+
+    template<typename T>
+    std::size_t WorkStealingDeque<T>::round_capacity(std::size_t capacity) {
+        std::size_t rounded = 1u;
+        while (rounded < capacity)
+            rounded <<= 1;
+        return rounded;
+    }
+
+}  // namespace structures
+
+#endif